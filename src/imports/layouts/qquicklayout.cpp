@@ -750,6 +750,22 @@ void QQuickLayout::invalidate(QQuickItem * /*childItem*/)
     }
 }
 
+/*!
+   \internal
+
+    Marks this layout and its ancestor layouts as needing to be rearranged, without
+    invalidating their size hints. This is enough when a child changed but the size
+    hints of this layout did not, since the parent layouts will then give it the
+    same geometry as before.
+ */
+void QQuickLayout::invalidateArrangement()
+{
+    for (QQuickLayout *layout = this; layout && !layout->m_dirty;
+         layout = qobject_cast<QQuickLayout *>(layout->parentItem())) {
+        layout->QQuickLayout::invalidate();
+    }
+}
+
 bool QQuickLayout::shouldIgnoreItem(QQuickItem *child, QQuickLayoutAttached *&info, QSizeF *sizeHints) const
 {
     Q_D(const QQuickLayout);
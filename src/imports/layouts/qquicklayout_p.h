@@ -79,6 +79,7 @@ public:
     virtual QSizeF sizeHint(Qt::SizeHint whichSizeHint) const = 0;
     virtual void setAlignment(QQuickItem *item, Qt::Alignment align) = 0;
     virtual void invalidate(QQuickItem * childItem = 0);
+    void invalidateArrangement();
     virtual void updateLayoutItems() = 0;
 
     // iterator
@@ -390,10 +390,24 @@ void QQuickGridLayoutBase::invalidate(QQuickItem *childItem)
     info->setMinimumImplicitSize(min);
     info->setMaximumImplicitSize(max);
     info->setChangesNotificationEnabled(old);
+
+    const bool sizeHintsChanged = min != d->m_sizeHints[Qt::MinimumSize]
+            || pref != d->m_sizeHints[Qt::PreferredSize]
+            || max != d->m_sizeHints[Qt::MaximumSize];
+    d->m_sizeHints[Qt::MinimumSize] = min;
+    d->m_sizeHints[Qt::PreferredSize] = pref;
+    d->m_sizeHints[Qt::MaximumSize] = max;
+
     if (pref.width() == implicitWidth() && pref.height() == implicitHeight()) {
         // In case setImplicitSize does not emit implicit{Width|Height}Changed
-        if (QQuickLayout *parentLayout = qobject_cast<QQuickLayout *>(parentItem()))
-            parentLayout->invalidate(this);
+        if (QQuickLayout *parentLayout = qobject_cast<QQuickLayout *>(parentItem())) {
+            // If our size hints are the same, the parent layouts don't need to
+            // recompute theirs, they only need to rearrange us.
+            if (sizeHintsChanged)
+                parentLayout->invalidate(this);
+            else
+                parentLayout->invalidateArrangement();
+        }
     } else {
         setImplicitSize(pref.width(), pref.height());
     }
@@ -484,9 +498,22 @@ void QQuickGridLayoutBase::rearrange(const QSizeF &size)
     d->engine.setGeometries(QRectF(QPointF(0,0), size), d->styleInfo);
     d->m_rearranging = false;
 
-    for (QQuickItem *invalid : qAsConst(d->m_invalidateAfterRearrange))
-        invalidate(invalid);
-    d->m_invalidateAfterRearrange.clear();
+    if (!d->m_invalidateAfterRearrange.isEmpty()) {
+        // Several children often change during one arrangement. Dirty all of their
+        // cached size hints first, so that the layout is only invalidated once.
+        for (QQuickItem *invalid : qAsConst(d->m_invalidateAfterRearrange)) {
+            if (!invalid)
+                continue;
+            if (d->m_ignoredItems.contains(invalid))
+                d->m_updateAfterRearrange = true;
+            else if (QQuickGridLayoutItem *layoutItem = d->engine.findLayoutItem(invalid))
+                layoutItem->invalidate();
+        }
+        d->m_invalidateAfterRearrange.clear();
+        // updateLayoutItems() below invalidates the layout as well
+        if (!d->m_updateAfterRearrange)
+            invalidate();
+    }
 
     if (d->m_updateAfterRearrange) {
         updateLayoutItems();
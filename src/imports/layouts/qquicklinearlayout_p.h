@@ -122,6 +122,9 @@ public:
     QVector<QQuickItem *> m_invalidateAfterRearrange;
     Qt::LayoutDirection m_layoutDirection : 2;
 
+    // The minimum, preferred and maximum size last reported to the parent
+    QSizeF m_sizeHints[QQuickLayout::NSizes];
+
     QQuickLayoutStyleInfo *styleInfo;
 };
 
@@ -228,6 +228,10 @@ void CompilationUnit::unlink()
     qmlEngine = nullptr;
     free(runtimeStrings);
     runtimeStrings = nullptr;
+    if (runtimeLookups) {
+        for (uint i = 0; i < data->lookupTableSize; ++i)
+            runtimeLookups[i].releasePropertyCache();
+    }
     delete [] runtimeLookups;
     runtimeLookups = nullptr;
     delete [] runtimeRegularExpressions;
@@ -165,7 +165,6 @@ QQmlPropertyCache *QJSEnginePrivate::cache(QObject *obj)
     if (!obj || QObjectPrivate::get(obj)->metaObject || QObjectPrivate::get(obj)->wasDeleted)
         return nullptr;
 
-    Locker locker(this);
     const QMetaObject *mo = obj->metaObject();
     return QQmlMetaType::propertyCache(mo);
 }
@@ -183,7 +182,6 @@ QQmlPropertyCache *QJSEnginePrivate::cache(const QMetaObject *metaObject)
 {
     Q_ASSERT(metaObject);
 
-    Locker locker(this);
     return QQmlMetaType::propertyCache(metaObject);
 }
 
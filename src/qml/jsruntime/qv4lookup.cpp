@@ -40,7 +40,9 @@
 #include "qv4functionobject_p.h"
 #include "qv4jscall_p.h"
 #include "qv4string_p.h"
+#include "qv4qobjectwrapper_p.h"
 #include <private/qv4identifiertable_p.h>
+#include <private/qqmlpropertycache_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -69,6 +71,9 @@ void Lookup::resolveProtoGetter(Identifier *name, const Heap::Object *proto)
 
 ReturnedValue Lookup::resolveGetter(ExecutionEngine *engine, const Object *object)
 {
+    if (const QObjectWrapper *wrapper = object->as<QObjectWrapper>())
+        return QObjectWrapper::resolveLookupGetter(wrapper, engine, this);
+
     Heap::Object *obj = object->d();
     Identifier *name = engine->identifierTable->identifier(engine->currentStackFrame->v4Function->compilationUnit->runtimeStrings[nameIndex]);
 
@@ -171,6 +176,13 @@ ReturnedValue Lookup::getterTwoClasses(Lookup *l, ExecutionEngine *engine, const
 
         ReturnedValue result = second.resolveGetter(engine, o);
 
+        if (second.getter == QObjectWrapper::lookupGetter) {
+            // Don't mix QObject property lookups with JS object lookups
+            second.releasePropertyCache();
+            l->getter = getterFallback;
+            return result;
+        }
+
         if (first.getter == getter0Inline && (second.getter == getter0Inline || second.getter == getter0MemberData)) {
             l->objectLookupTwoClasses.ic = first.objectLookup.ic;
             l->objectLookupTwoClasses.ic2 = second.objectLookup.ic;
@@ -439,6 +451,9 @@ ReturnedValue Lookup::globalGetterProtoAccessor(Lookup *l, ExecutionEngine *engi
 
 bool Lookup::resolveSetter(ExecutionEngine *engine, Object *object, const Value &value)
 {
+    if (QObjectWrapper *wrapper = object->as<QObjectWrapper>())
+        return QObjectWrapper::resolveLookupSetter(wrapper, engine, this, value);
+
     Scope scope(engine);
     ScopedString name(scope, scope.engine->currentStackFrame->v4Function->compilationUnit->runtimeStrings[nameIndex]);
 
@@ -514,6 +529,8 @@ bool Lookup::setterTwoClasses(Lookup *l, ExecutionEngine *engine, Value &object,
             l->setter = setter0setter0;
             return true;
         }
+        if (l->setter == QObjectWrapper::lookupSetter)
+            return true;
     }
 
     l->setter = setterFallback;
@@ -584,6 +601,15 @@ bool Lookup::setterInsert(Lookup *l, ExecutionEngine *engine, Value &object, con
     return setterFallback(l, engine, object, value);
 }
 
+void Lookup::releasePropertyCache()
+{
+    if (getter == QObjectWrapper::lookupGetter || setter == QObjectWrapper::lookupSetter) {
+        if (QQmlPropertyCache *pc = qobjectLookup.propertyCache)
+            pc->release();
+        qobjectLookup.propertyCache = nullptr;
+    }
+}
+
 bool Lookup::arrayLengthSetter(Lookup *, ExecutionEngine *engine, Value &object, const Value &value)
 {
     Q_ASSERT(object.isObject() && static_cast<Object &>(object).isArrayObject());
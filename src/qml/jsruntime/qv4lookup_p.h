@@ -62,6 +62,9 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQmlPropertyCache;
+class QQmlPropertyData;
+
 namespace QV4 {
 
 struct Lookup {
@@ -104,6 +107,11 @@ struct Lookup {
             int icIdentifier;
             int offset;
         } insertionLookup;
+        struct {
+            InternalClass *ic;
+            QQmlPropertyCache *propertyCache;
+            QQmlPropertyData *propertyData;
+        } qobjectLookup;
     };
     uint nameIndex;
 
@@ -144,6 +152,8 @@ struct Lookup {
     static bool setter0setter0(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool setterInsert(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool arrayLengthSetter(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+
+    void releasePropertyCache();
 };
 
 Q_STATIC_ASSERT(std::is_standard_layout<Lookup>::value);
@@ -64,6 +64,7 @@
 #include <private/qv4scopedvalue_p.h>
 #include <private/qv4jscall_p.h>
 #include <private/qv4mm_p.h>
+#include <private/qv4lookup_p.h>
 #include <private/qqmlscriptstring_p.h>
 #include <private/qv4compileddata_p.h>
 
@@ -661,6 +662,119 @@ void QObjectWrapper::setProperty(ExecutionEngine *engine, QObject *object, int p
     return setProperty(engine, object, property, value);
 }
 
+// The property a name resolves to depends on the calling context when the object's QML
+// types override properties of their base types (see QQmlPropertyCache::findProperty).
+// Such lookups cannot be cached by property cache alone.
+static bool canCacheLookup(QObject *object, const QQmlPropertyCache *cache)
+{
+    QQmlData *ddata = QQmlData::get(object, /*create*/false);
+    return !ddata || !ddata->hasVMEMetaObject || !cache->hasPropertyOverrides();
+}
+
+ReturnedValue QObjectWrapper::resolveLookupGetter(const QObjectWrapper *wrapper, ExecutionEngine *engine, Lookup *lookup)
+{
+    QObject *qobj = wrapper->d()->object();
+    if (QQmlData::wasDeleted(qobj))
+        return Lookup::getterFallback(lookup, engine, *wrapper);
+
+    Scope scope(engine);
+    ScopedString name(scope, engine->currentStackFrame->v4Function->compilationUnit->runtimeStrings[lookup->nameIndex]);
+
+    QQmlPropertyCache *cache = nullptr;
+    if (!name->equals(engine->id_destroy()) && !name->equals(engine->id_toString())) {
+        if (QJSEngine *jsEngine = engine->jsEngine())
+            cache = QQmlData::ensurePropertyCache(jsEngine, qobj);
+    }
+
+    QQmlPropertyData *property = cache ? cache->property(name.getPointer(), qobj, engine->callingQmlContext()) : nullptr;
+    if (!property || !canCacheLookup(qobj, cache)) {
+        lookup->getter = Lookup::getterFallback;
+        return Lookup::getterFallback(lookup, engine, *wrapper);
+    }
+
+    // Remember the property cache the property was resolved against; as long as the object we
+    // see at this call site has the same cache, the property data can be used without any
+    // name lookup.
+    cache->addref();
+    lookup->qobjectLookup.ic = wrapper->internalClass();
+    lookup->qobjectLookup.propertyCache = cache;
+    lookup->qobjectLookup.propertyData = property;
+    lookup->getter = lookupGetter;
+    return getProperty(engine, qobj, property);
+}
+
+bool QObjectWrapper::resolveLookupSetter(QObjectWrapper *wrapper, ExecutionEngine *engine, Lookup *lookup, const Value &value)
+{
+    QObject *qobj = wrapper->d()->object();
+    if (engine->hasException || QQmlData::wasDeleted(qobj))
+        return false;
+
+    Scope scope(engine);
+    ScopedString name(scope, engine->currentStackFrame->v4Function->compilationUnit->runtimeStrings[lookup->nameIndex]);
+
+    QQmlPropertyCache *cache = nullptr;
+    if (QJSEngine *jsEngine = engine->jsEngine())
+        cache = QQmlData::ensurePropertyCache(jsEngine, qobj);
+
+    QQmlPropertyData *property = cache ? cache->property(name.getPointer(), qobj, engine->callingQmlContext()) : nullptr;
+    if (!property || !canCacheLookup(qobj, cache)) {
+        lookup->setter = Lookup::setterFallback;
+        return Lookup::setterFallback(lookup, engine, *wrapper, value);
+    }
+
+    cache->addref();
+    lookup->qobjectLookup.ic = wrapper->internalClass();
+    lookup->qobjectLookup.propertyCache = cache;
+    lookup->qobjectLookup.propertyData = property;
+    lookup->setter = lookupSetter;
+    setProperty(engine, qobj, property, value);
+    return true;
+}
+
+ReturnedValue QObjectWrapper::lookupGetter(Lookup *lookup, ExecutionEngine *engine, const Value &object)
+{
+    // we can safely cast to a QV4::Object here. If object is something else,
+    // the internal class won't match
+    Heap::Object *o = static_cast<Heap::Object *>(object.heapObject());
+    if (o && o->internalClass == lookup->qobjectLookup.ic) {
+        QObject *qobj = static_cast<Heap::QObjectWrapper *>(o)->object();
+        if (QQmlData::wasDeleted(qobj))
+            return QV4::Encode::undefined();
+
+        QQmlData *ddata = QQmlData::get(qobj, /*create*/false);
+        if (ddata && ddata->propertyCache == lookup->qobjectLookup.propertyCache)
+            return getProperty(engine, qobj, lookup->qobjectLookup.propertyData);
+    }
+
+    // Objects of different types pass through this call site; don't resolve the lookup
+    // again for every one of them.
+    lookup->releasePropertyCache();
+    lookup->getter = Lookup::getterFallback;
+    return Lookup::getterFallback(lookup, engine, object);
+}
+
+bool QObjectWrapper::lookupSetter(Lookup *lookup, ExecutionEngine *engine, Value &object, const Value &value)
+{
+    // we can safely cast to a QV4::Object here. If object is something else,
+    // the internal class won't match
+    Heap::Object *o = static_cast<Heap::Object *>(object.heapObject());
+    if (o && o->internalClass == lookup->qobjectLookup.ic) {
+        QObject *qobj = static_cast<Heap::QObjectWrapper *>(o)->object();
+        if (engine->hasException || QQmlData::wasDeleted(qobj))
+            return false;
+
+        QQmlData *ddata = QQmlData::get(qobj, /*create*/false);
+        if (ddata && ddata->propertyCache == lookup->qobjectLookup.propertyCache) {
+            setProperty(engine, qobj, lookup->qobjectLookup.propertyData, value);
+            return true;
+        }
+    }
+
+    lookup->releasePropertyCache();
+    lookup->setter = Lookup::setterFallback;
+    return Lookup::setterFallback(lookup, engine, object, value);
+}
+
 bool QObjectWrapper::isEqualTo(Managed *a, Managed *b)
 {
     Q_ASSERT(a->as<QV4::QObjectWrapper>());
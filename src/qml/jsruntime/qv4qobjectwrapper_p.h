@@ -182,6 +182,11 @@ struct Q_QML_EXPORT QObjectWrapper : public Object
 
     void destroyObject(bool lastCall);
 
+    static ReturnedValue resolveLookupGetter(const QObjectWrapper *wrapper, ExecutionEngine *engine, Lookup *lookup);
+    static bool resolveLookupSetter(QObjectWrapper *wrapper, ExecutionEngine *engine, Lookup *lookup, const Value &value);
+    static ReturnedValue lookupGetter(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static bool lookupSetter(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+
 protected:
     static bool isEqualTo(Managed *that, Managed *o);
 
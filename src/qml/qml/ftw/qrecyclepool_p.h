@@ -51,6 +51,10 @@
 // We mean it.
 //
 
+#include <QtCore/qglobal.h>
+
+#include <utility>
+
 QT_BEGIN_NAMESPACE
 
 #define QRECYCLEPOOLCOOKIE 0x33218ADF
@@ -106,6 +110,8 @@ public:
     inline T *New(const T1 &);
     template<typename T1>
     inline T *New(T1 &);
+    template<typename T1, typename T2, typename... Rest>
+    inline T *New(T1 &&, T2 &&, Rest &&...);
 
     static inline void Delete(T *);
 
@@ -152,6 +158,15 @@ T *QRecyclePool<T, Step>::New(T1 &a)
     return rv;
 }
 
+template<typename T, int Step>
+template<typename T1, typename T2, typename... Rest>
+T *QRecyclePool<T, Step>::New(T1 &&a, T2 &&b, Rest &&... rest)
+{
+    T *rv = d->allocate();
+    new (rv) T(std::forward<T1>(a), std::forward<T2>(b), std::forward<Rest>(rest)...);
+    return rv;
+}
+
 template<typename T, int Step>
 void QRecyclePool<T, Step>::Delete(T *t)
 {
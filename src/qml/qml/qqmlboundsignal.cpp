@@ -292,6 +292,23 @@ QQmlBoundSignal::~QQmlBoundSignal()
     removeFromObject();
 }
 
+/*! \internal
+    Allocates a bound signal from the recycle pool of \a engine. Signal handlers are created
+    for every on<Signal> binding of every object, so we avoid a separate heap allocation for
+    each of them. A bound signal created this way must be destroyed with Delete().
+*/
+QQmlBoundSignal *QQmlBoundSignal::New(QObject *target, int signal, QObject *owner,
+                                      QQmlEngine *engine)
+{
+    Q_ASSERT(engine);
+    return QQmlEnginePrivate::get(engine)->boundSignalPool.New(target, signal, owner, engine);
+}
+
+void QQmlBoundSignal::Delete()
+{
+    QRecyclePool<QQmlBoundSignal, 256>::Delete(this);
+}
+
 void QQmlBoundSignal::addToObject(QObject *obj)
 {
     Q_ASSERT(!m_prevSignal);
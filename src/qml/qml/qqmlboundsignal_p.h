@@ -108,6 +108,9 @@ public:
     QQmlBoundSignal(QObject *target, int signal, QObject *owner, QQmlEngine *engine);
     ~QQmlBoundSignal();
 
+    static QQmlBoundSignal *New(QObject *target, int signal, QObject *owner, QQmlEngine *engine);
+    void Delete();
+
     void removeFromObject();
 
     QQmlBoundSignalExpression *expression() const;
@@ -1841,7 +1841,7 @@ void QQmlData::destroyed(QObject *object)
         QQmlBoundSignal *next = signalHandler->m_nextSignal;
         signalHandler->m_prevSignal = nullptr;
         signalHandler->m_nextSignal = nullptr;
-        delete signalHandler;
+        signalHandler->Delete();
         signalHandler = next;
     }
 
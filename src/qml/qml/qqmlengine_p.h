@@ -101,6 +101,7 @@ class QDir;
 class QQmlIncubator;
 class QQmlProfiler;
 class QQmlPropertyCapture;
+class QQmlBoundSignal;
 
 // This needs to be declared here so that the pool for it can live in QQmlEnginePrivate.
 // The inline method definitions are in qqmljavascriptexpression_p.h
@@ -132,6 +133,7 @@ public:
     QQmlPropertyCapture *propertyCapture;
 
     QRecyclePool<QQmlJavaScriptExpressionGuard> jsExpressionGuardPool;
+    QRecyclePool<QQmlBoundSignal, 256> boundSignalPool;
 
     QQmlContext *rootContext;
 
@@ -160,6 +160,14 @@ public:
 
 Q_GLOBAL_STATIC(QQmlMetaTypeData, metaTypeData)
 Q_GLOBAL_STATIC_WITH_ARGS(QMutex, metaTypeDataLock, (QMutex::Recursive))
+// Guards QQmlMetaTypeData::propertyCaches, in addition to metaTypeDataLock. Lookups of
+// existing caches only take it for reading, modifications take both locks.
+Q_GLOBAL_STATIC(QReadWriteLock, propertyCacheLock)
+// Guards the idToType, nameToType, urlToType, urlToNonFileImportType and metaObjectToType
+// lookup tables the same way, so that qmlType() doesn't contend on metaTypeDataLock. Only
+// the modifications of the tables themselves are done with it locked for writing, so it is
+// never locked for reading while the same thread holds it for writing.
+Q_GLOBAL_STATIC(QReadWriteLock, typeLookupLock)
 
 static uint qHash(const QQmlMetaTypeData::VersionedUri &v)
 {
@@ -1522,12 +1530,15 @@ void qmlClearTypeRegistrations() // Declared in qqml.h
     for (QQmlMetaTypeData::TypeModules::const_iterator i = data->uriToModule.constBegin(), cend = data->uriToModule.constEnd(); i != cend; ++i)
         delete *i;
 
+    {
+        QWriteLocker lookupLock(typeLookupLock());
+        data->idToType.clear();
+        data->nameToType.clear();
+        data->urlToType.clear();
+        data->urlToNonFileImportType.clear();
+        data->metaObjectToType.clear();
+    }
     data->types.clear();
-    data->idToType.clear();
-    data->nameToType.clear();
-    data->urlToType.clear();
-    data->urlToNonFileImportType.clear();
-    data->metaObjectToType.clear();
     data->uriToModule.clear();
     data->undeletableTypes.clear();
 
@@ -1559,11 +1570,14 @@ QQmlType registerInterface(const QQmlPrivate::RegisterInterface &interface)
     QQmlTypePrivate *priv = type.priv();
     Q_ASSERT(priv);
 
-    data->idToType.insert(priv->typeId, priv);
-    data->idToType.insert(priv->listId, priv);
-    // XXX No insertMulti, so no multi-version interfaces?
-    if (!priv->elementName.isEmpty())
-        data->nameToType.insert(priv->elementName, priv);
+    {
+        QWriteLocker lookupLock(typeLookupLock());
+        data->idToType.insert(priv->typeId, priv);
+        data->idToType.insert(priv->listId, priv);
+        // XXX No insertMulti, so no multi-version interfaces?
+        if (!priv->elementName.isEmpty())
+            data->nameToType.insert(priv->elementName, priv);
+    }
 
     if (data->interfaces.size() <= interface.typeId)
         data->interfaces.resize(interface.typeId + 16);
@@ -1656,14 +1670,19 @@ void addTypeToData(QQmlTypePrivate *type, QQmlMetaTypeData *data)
 {
     Q_ASSERT(type);
 
-    if (!type->elementName.isEmpty())
-        data->nameToType.insertMulti(type->elementName, type);
-
-    if (type->baseMetaObject)
-        data->metaObjectToType.insertMulti(type->baseMetaObject, type);
+    {
+        QWriteLocker lookupLock(typeLookupLock());
+        if (!type->elementName.isEmpty())
+            data->nameToType.insertMulti(type->elementName, type);
+        if (type->baseMetaObject)
+            data->metaObjectToType.insertMulti(type->baseMetaObject, type);
+        if (type->typeId)
+            data->idToType.insert(type->typeId, type);
+        if (type->listId)
+            data->idToType.insert(type->listId, type);
+    }
 
     if (type->typeId) {
-        data->idToType.insert(type->typeId, type);
         if (data->objects.size() <= type->typeId)
             data->objects.resize(type->typeId + 16);
         data->objects.setBit(type->typeId, true);
@@ -1673,7 +1692,6 @@ void addTypeToData(QQmlTypePrivate *type, QQmlMetaTypeData *data)
         if (data->lists.size() <= type->listId)
             data->lists.resize(type->listId + 16);
         data->lists.setBit(type->listId, true);
-        data->idToType.insert(type->listId, type);
     }
 
     if (!type->module.isEmpty()) {
@@ -1696,8 +1714,10 @@ QQmlType registerType(const QQmlPrivate::RegisterType &type)
     QQmlType dtype(data, elementName, type);
 
     addTypeToData(dtype.priv(), data);
-    if (!type.typeId)
+    if (!type.typeId) {
+        QWriteLocker lookupLock(typeLookupLock());
         data->idToType.insert(dtype.typeId(), dtype.priv());
+    }
 
     return dtype;
 }
@@ -1734,7 +1754,9 @@ QQmlType QQmlMetaType::registerCompositeSingletonType(const QQmlPrivate::Registe
     addTypeToData(dtype.priv(), data);
 
     QQmlMetaTypeData::Files *files = fileImport ? &(data->urlToType) : &(data->urlToNonFileImportType);
-    files->insertMulti(QQmlTypeLoader::normalize(type.url), dtype.priv());
+    const QUrl url = QQmlTypeLoader::normalize(type.url);
+    QWriteLocker lookupLock(typeLookupLock());
+    files->insertMulti(url, dtype.priv());
 
     return dtype;
 }
@@ -1755,7 +1777,9 @@ QQmlType QQmlMetaType::registerCompositeType(const QQmlPrivate::RegisterComposit
     addTypeToData(dtype.priv(), data);
 
     QQmlMetaTypeData::Files *files = fileImport ? &(data->urlToType) : &(data->urlToNonFileImportType);
-    files->insertMulti(QQmlTypeLoader::normalize(type.url), dtype.priv());
+    const QUrl url = QQmlTypeLoader::normalize(type.url);
+    QWriteLocker lookupLock(typeLookupLock());
+    files->insertMulti(url, dtype.priv());
 
     return dtype;
 }
@@ -2198,8 +2222,8 @@ QQmlType QQmlMetaType::qmlType(const QString &qualifiedName, int version_major,
 QQmlType QQmlMetaType::qmlType(const QHashedStringRef &name, const QHashedStringRef &module, int version_major, int version_minor)
 {
     Q_ASSERT(version_major >= 0 && version_minor >= 0);
-    QMutexLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QReadLocker lookupLock(typeLookupLock());
+    const QQmlMetaTypeData *data = metaTypeData();
 
     QQmlMetaTypeData::Names::ConstIterator it = data->nameToType.constFind(name);
     while (it != data->nameToType.cend() && it.key() == name) {
@@ -2219,8 +2243,8 @@ QQmlType QQmlMetaType::qmlType(const QHashedStringRef &name, const QHashedString
 */
 QQmlType QQmlMetaType::qmlType(const QMetaObject *metaObject)
 {
-    QMutexLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QReadLocker lookupLock(typeLookupLock());
+    const QQmlMetaTypeData *data = metaTypeData();
 
     return QQmlType(data->metaObjectToType.value(metaObject));
 }
@@ -2233,8 +2257,8 @@ QQmlType QQmlMetaType::qmlType(const QMetaObject *metaObject)
 QQmlType QQmlMetaType::qmlType(const QMetaObject *metaObject, const QHashedStringRef &module, int version_major, int version_minor)
 {
     Q_ASSERT(version_major >= 0 && version_minor >= 0);
-    QMutexLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QReadLocker lookupLock(typeLookupLock());
+    const QQmlMetaTypeData *data = metaTypeData();
 
     QQmlMetaTypeData::MetaObjects::const_iterator it = data->metaObjectToType.constFind(metaObject);
     while (it != data->metaObjectToType.cend() && it.key() == metaObject) {
@@ -2253,8 +2277,8 @@ QQmlType QQmlMetaType::qmlType(const QMetaObject *metaObject, const QHashedStrin
 */
 QQmlType QQmlMetaType::qmlType(int userType)
 {
-    QMutexLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QReadLocker lookupLock(typeLookupLock());
+    const QQmlMetaTypeData *data = metaTypeData();
 
     QQmlTypePrivate *type = data->idToType.value(userType);
     if (type && type->typeId == userType)
@@ -2272,8 +2296,8 @@ QQmlType QQmlMetaType::qmlType(int userType)
 QQmlType QQmlMetaType::qmlType(const QUrl &unNormalizedUrl, bool includeNonFileImports /* = false */)
 {
     const QUrl url = QQmlTypeLoader::normalize(unNormalizedUrl);
-    QMutexLocker lock(metaTypeDataLock());
-    QQmlMetaTypeData *data = metaTypeData();
+    QReadLocker lookupLock(typeLookupLock());
+    const QQmlMetaTypeData *data = metaTypeData();
 
     QQmlType type(data->urlToType.value(url));
     if (!type.isValid() && includeNonFileImports)
@@ -2290,19 +2314,28 @@ QQmlPropertyCache *QQmlMetaTypeData::propertyCache(const QMetaObject *metaObject
     if (QQmlPropertyCache *rv = propertyCaches.value(metaObject))
         return rv;
 
+    QQmlPropertyCache *rv = nullptr;
     if (!metaObject->superClass()) {
-        QQmlPropertyCache *rv = new QQmlPropertyCache(metaObject);
-        propertyCaches.insert(metaObject, rv);
-        return rv;
+        rv = new QQmlPropertyCache(metaObject);
+    } else {
+        QQmlPropertyCache *super = propertyCache(metaObject->superClass());
+        rv = super->copyAndAppend(metaObject);
     }
-    QQmlPropertyCache *super = propertyCache(metaObject->superClass());
-    QQmlPropertyCache *rv = super->copyAndAppend(metaObject);
+    QWriteLocker cacheLock(propertyCacheLock());
     propertyCaches.insert(metaObject, rv);
     return rv;
 }
 
 QQmlPropertyCache *QQmlMetaType::propertyCache(const QMetaObject *metaObject)
 {
+    // Once created, the cache of a C++ type is found without taking metaTypeDataLock. This
+    // is what both the GUI and the type loader thread hit most of the time.
+    {
+        QReadLocker cacheLock(propertyCacheLock());
+        if (QQmlPropertyCache *rv = metaTypeData()->propertyCaches.value(metaObject))
+            return rv;
+    }
+
     QMutexLocker lock(metaTypeDataLock());
     QQmlMetaTypeData *data = metaTypeData();
     return data->propertyCache(metaObject);
@@ -2427,11 +2460,14 @@ void qmlUnregisterType(int typeIndex)
     {
         const QQmlTypePrivate *d = data->types.value(typeIndex).priv();
         if (d) {
-            removeQQmlTypePrivate(data->idToType, d);
-            removeQQmlTypePrivate(data->nameToType, d);
-            removeQQmlTypePrivate(data->urlToType, d);
-            removeQQmlTypePrivate(data->urlToNonFileImportType, d);
-            removeQQmlTypePrivate(data->metaObjectToType, d);
+            {
+                QWriteLocker lookupLock(typeLookupLock());
+                removeQQmlTypePrivate(data->idToType, d);
+                removeQQmlTypePrivate(data->nameToType, d);
+                removeQQmlTypePrivate(data->urlToType, d);
+                removeQQmlTypePrivate(data->urlToNonFileImportType, d);
+                removeQQmlTypePrivate(data->metaObjectToType, d);
+            }
             for (QQmlMetaTypeData::TypeModules::Iterator module = data->uriToModule.begin(); module != data->uriToModule.end(); ++module) {
                  QQmlTypeModulePrivate *modulePrivate = (*module)->priv();
                  modulePrivate->remove(d);
@@ -2456,11 +2492,16 @@ void QQmlMetaType::freeUnusedTypesAndCaches()
                 if (d && d->refCount == 1) {
                     deletedAtLeastOneType = true;
 
-                    removeQQmlTypePrivate(data->idToType, d);
-                    removeQQmlTypePrivate(data->nameToType, d);
-                    removeQQmlTypePrivate(data->urlToType, d);
-                    removeQQmlTypePrivate(data->urlToNonFileImportType, d);
-                    removeQQmlTypePrivate(data->metaObjectToType, d);
+                    // A concurrent qmlType() may still take a reference before the type is
+                    // removed from the lookup tables. It then keeps the type alive below.
+                    {
+                        QWriteLocker lookupLock(typeLookupLock());
+                        removeQQmlTypePrivate(data->idToType, d);
+                        removeQQmlTypePrivate(data->nameToType, d);
+                        removeQQmlTypePrivate(data->urlToType, d);
+                        removeQQmlTypePrivate(data->urlToNonFileImportType, d);
+                        removeQQmlTypePrivate(data->metaObjectToType, d);
+                    }
 
                     for (QQmlMetaTypeData::TypeModules::Iterator module = data->uriToModule.begin(); module != data->uriToModule.end(); ++module) {
                         QQmlTypeModulePrivate *modulePrivate = (*module)->priv();
@@ -2476,6 +2517,8 @@ void QQmlMetaType::freeUnusedTypesAndCaches()
     }
 
     {
+        QWriteLocker cacheLock(propertyCacheLock());
+
         bool deletedAtLeastOneCache;
         do {
             deletedAtLeastOneCache = false;
@@ -880,7 +880,7 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *bindingProper
         if (binding->flags & QV4::CompiledData::Binding::IsSignalHandlerExpression) {
             QV4::Function *runtimeFunction = compilationUnit->runtimeFunctions[binding->value.compiledScriptIndex];
             int signalIndex = _propertyCache->methodIndexToSignalIndex(bindingProperty->coreIndex());
-            QQmlBoundSignal *bs = new QQmlBoundSignal(_bindingTarget, signalIndex, _scopeObject, engine);
+            QQmlBoundSignal *bs = QQmlBoundSignal::New(_bindingTarget, signalIndex, _scopeObject, engine);
             QQmlBoundSignalExpression *expr = new QQmlBoundSignalExpression(_bindingTarget, signalIndex,
                                                                             context, _scopeObject, runtimeFunction, currentQmlContext());
 
@@ -1364,17 +1364,18 @@ QQmlContextData *QQmlObjectCreator::finalize(QQmlInstantiationInterrupt &interru
         }
     }
 
-    for (int ii = 0; ii < sharedState->finalizeCallbacks.count(); ++ii) {
-        QQmlEnginePrivate::FinalizeCallback callback = sharedState->finalizeCallbacks.at(ii);
+    // Callbacks are consumed as they are run, so that an interrupted incubation resumes with
+    // the next pending callback instead of running the already invoked ones again.
+    while (!sharedState->finalizeCallbacks.isEmpty()) {
+        QQmlEnginePrivate::FinalizeCallback callback = sharedState->finalizeCallbacks.takeFirst();
         QObject *obj = callback.first;
         if (obj) {
             void *args[] = { nullptr };
             QMetaObject::metacall(obj, QMetaObject::InvokeMetaMethod, callback.second, args);
         }
-        if (watcher.hasRecursed())
+        if (watcher.hasRecursed() || interrupt.shouldInterrupt())
             return nullptr;
     }
-    sharedState->finalizeCallbacks.clear();
 
     while (sharedState->componentAttached) {
         QQmlComponentAttached *a = sharedState->componentAttached;
@@ -447,6 +447,7 @@ public:
 
     inline QQmlPropertyData *overrideData(QQmlPropertyData *) const;
     inline bool isAllowedInRevision(QQmlPropertyData *) const;
+    inline bool hasPropertyOverrides() const;
 
     static QQmlPropertyData *property(QJSEngine *, QObject *, const QStringRef &,
                                               QQmlContextData *, QQmlPropertyData &);
@@ -816,6 +817,17 @@ inline QQmlPropertyCache *QQmlPropertyCache::parent() const
     return _parent;
 }
 
+// Returns true if a property, method or signal in this cache or any of its parents
+// shadows one of the same name further up the hierarchy.
+bool QQmlPropertyCache::hasPropertyOverrides() const
+{
+    for (const QQmlPropertyCache *cache = this; cache; cache = cache->_parent) {
+        if (cache->_hasPropertyOverrides)
+            return true;
+    }
+    return false;
+}
+
 QQmlPropertyData *
 QQmlPropertyCache::overrideData(QQmlPropertyData *data) const
 {
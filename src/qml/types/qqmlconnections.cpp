@@ -156,7 +156,7 @@ class QQmlBoundSignalDeleter : public QObject
 {
 public:
     QQmlBoundSignalDeleter(QQmlBoundSignal *signal) : m_signal(signal) { m_signal->removeFromObject(); }
-    ~QQmlBoundSignalDeleter() { delete m_signal; }
+    ~QQmlBoundSignalDeleter() { m_signal->Delete(); }
 
 private:
     QQmlBoundSignal *m_signal;
@@ -174,7 +174,7 @@ void QQmlConnections::setTarget(QObject *obj)
         if (s->isNotifying())
             (new QQmlBoundSignalDeleter(s))->deleteLater();
         else
-            delete s;
+            s->Delete();
     }
     d->boundsignals.clear();
     d->target = obj;
@@ -285,7 +285,7 @@ void QQmlConnections::connectSignals()
         if (prop.isValid() && (prop.type() & QQmlProperty::SignalProperty)) {
             int signalIndex = QQmlPropertyPrivate::get(prop)->signalIndex();
             QQmlBoundSignal *signal =
-                new QQmlBoundSignal(target, signalIndex, this, qmlEngine(this));
+                QQmlBoundSignal::New(target, signalIndex, this, qmlEngine(this));
             signal->setEnabled(d->enabled);
 
             auto f = d->compilationUnit->runtimeFunctions[binding->value.compiledScriptIndex];
@@ -40,6 +40,12 @@
 #include "qqmldelegatemodel_p_p.h"
 
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qjsvalue.h>
+#include <QtCore/qregexp.h>
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
 
 #include <private/qquickpackage_p.h>
 #include <private/qmetaobjectbuilder_p.h>
@@ -53,6 +59,8 @@
 #include <private/qv4functionobject_p.h>
 #include <qv4objectiterator_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 class QQmlDelegateModelItem;
@@ -207,7 +215,10 @@ QQmlDelegateModelPrivate::QQmlDelegateModelPrivate(QQmlContext *ctxt)
     , m_filterGroup(QStringLiteral("items"))
     , m_count(0)
     , m_groupCount(Compositor::MinimumGroupCount)
+    , m_prefetchCount(0)
+    , m_lastPrefetchIndex(-1)
     , m_compositorGroup(Compositor::Cache)
+    , m_sortOrder(Qt::AscendingOrder)
     , m_complete(false)
     , m_delegateValidated(false)
     , m_reset(false)
@@ -237,6 +248,16 @@ void QQmlDelegateModelPrivate::requestMoreIfNecessary()
     }
 }
 
+void QQmlDelegateModelPrivate::prefetch(int modelIndex)
+{
+    Q_Q(QQmlDelegateModel);
+    // Views request delegates in the direction they are scrolling, so prefetch
+    // the rows beyond the one requested in that same direction.
+    const bool forward = m_lastPrefetchIndex < 0 || modelIndex >= m_lastPrefetchIndex;
+    m_lastPrefetchIndex = modelIndex;
+    m_adaptorModel.prefetch(q, modelIndex, forward ? m_prefetchCount : -m_prefetchCount);
+}
+
 void QQmlDelegateModelPrivate::init()
 {
     Q_Q(QQmlDelegateModel);
@@ -263,8 +284,12 @@ QQmlDelegateModel::QQmlDelegateModel(QQmlContext *ctxt, QObject *parent)
 QQmlDelegateModel::~QQmlDelegateModel()
 {
     Q_D(QQmlDelegateModel);
+    // Disconnect from the model first so a prefetch batch still running on a
+    // worker thread cannot post its results to this object.
+    d->m_adaptorModel.invalidateModel(this);
 
-    for (QQmlDelegateModelItem *cacheItem : qAsConst(d->m_cache)) {
+    const QList<QQmlDelegateModelItem *> cacheItems = d->m_cache + d->m_reusableItemsPool;
+    for (QQmlDelegateModelItem *cacheItem : cacheItems) {
         if (cacheItem->object) {
             delete cacheItem->object;
 
@@ -344,6 +369,10 @@ void QQmlDelegateModel::componentComplete()
             defaultGroups | Compositor::AppendFlag | Compositor::PrependFlag,
             &inserts);
     d->itemsInserted(inserts);
+    if (const int filteredGroups = d->filteredGroups())
+        d->filterItems(0, d->m_compositor.count(Compositor::Default), filteredGroups);
+    if (d->isSorted())
+        d->sortItems();
     d->emitChanges();
     d->requestMoreIfNecessary();
 }
@@ -375,6 +404,9 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     if (d->m_complete)
         _q_itemsRemoved(0, d->m_count);
 
+    // Pooled items are bound to the data type of the old model and can't be rebound.
+    d->drainReusableItemsPool(0);
+
     d->m_adaptorModel.setModel(model, this, d->m_context->engine());
     d->m_adaptorModel.replaceWatchedRoles(QList<QByteArray>(), d->m_watchedRoles);
     for (int i = 0; d->m_parts && i < d->m_parts->models.count(); ++i) {
@@ -411,6 +443,7 @@ void QQmlDelegateModel::setDelegate(QQmlComponent *delegate)
     bool wasValid = d->m_delegate != nullptr;
     d->m_delegate = delegate;
     d->m_delegateValidated = false;
+    d->drainReusableItemsPool(0);
     if (wasValid && d->m_complete) {
         for (int i = 1; i < d->m_groupCount; ++i) {
             QQmlDelegateModelGroupPrivate::get(d->m_groups[i])->changeSet.remove(
@@ -486,6 +519,133 @@ void QQmlDelegateModel::setRootIndex(const QVariant &root)
     }
 }
 
+/*!
+    \qmlproperty int QtQml.Models::DelegateModel::prefetchCount
+    \since 5.11
+
+    This property holds the number of rows ahead of the requested delegate
+    whose data is fetched in a single batch.
+
+    When a view scrolls, it requests delegates one at a time and each
+    delegate reads its roles from the model individually.  With a non-zero
+    prefetch count, the roles the delegates have read so far are fetched for
+    the next \e prefetchCount rows in the scrolling direction, and delegates
+    created for those rows are served from that batch.
+
+    If the model class declares \c {Q_CLASSINFO("ThreadSafeData", "true")}
+    the batch is fetched on a worker thread, and delegates created before it
+    completes see undefined role values until the data arrives.  Otherwise
+    the batch is fetched on the GUI thread between frames.
+
+    The worker thread stops reading from the model before rows are inserted,
+    removed or moved, and before the model is reset or its layout changes.
+    Such a model has to be reset, or removed from the DelegateModel, before
+    it is destroyed.
+
+    The default value is 0, which disables prefetching.
+
+    \note Prefetching only applies to QAbstractItemModel based models.
+*/
+
+int QQmlDelegateModel::prefetchCount() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_prefetchCount;
+}
+
+void QQmlDelegateModel::setPrefetchCount(int count)
+{
+    Q_D(QQmlDelegateModel);
+    count = qMax(0, count);
+    if (d->m_prefetchCount == count)
+        return;
+
+    d->m_prefetchCount = count;
+    if (count == 0) {
+        d->m_adaptorModel.clearPrefetched();
+        d->m_lastPrefetchIndex = -1;
+    }
+    emit prefetchCountChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::sortRole
+    \since 5.11
+
+    This property holds the name of the model role the items are sorted by.
+
+    When set, the \l items group is kept in the order of the values of this
+    role, and with it the order of the items in every other group.  Items
+    whose values compare equal keep their relative order in the model.  The
+    role is read directly from the model, so no delegate items are created to
+    sort it, and items inserted into the model or whose value changes are
+    moved into place as the model reports the change.
+
+    Numbers, strings, dates and times are compared by value, and other values
+    by their string representation.  Items without a value for the role,
+    including items inserted from JavaScript, are placed after the others.
+
+    Sorting a large model for the first time uses several threads.
+
+    Setting the role to an empty string, which is the default, stops sorting
+    and leaves the items in their current order.
+
+    \sa sortOrder
+*/
+
+QString QQmlDelegateModel::sortRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortRole;
+}
+
+void QQmlDelegateModel::setSortRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortRole == role)
+        return;
+
+    d->m_sortRole = role;
+    if (d->m_complete && d->isSorted()) {
+        d->sortItems();
+        d->emitChanges();
+    }
+    emit sortRoleChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::DelegateModel::sortOrder
+    \since 5.11
+
+    This property holds the order the items are sorted in when \l sortRole
+    is set.
+
+    \list
+    \li Qt.AscendingOrder (default)
+    \li Qt.DescendingOrder
+    \endlist
+*/
+
+Qt::SortOrder QQmlDelegateModel::sortOrder() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_sortOrder;
+}
+
+void QQmlDelegateModel::setSortOrder(Qt::SortOrder order)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_sortOrder == order)
+        return;
+
+    d->m_sortOrder = order;
+    if (d->m_complete && d->isSorted()) {
+        d->sortItems();
+        d->emitChanges();
+    }
+    emit sortOrderChanged();
+}
+
 /*!
     \qmlmethod QModelIndex QtQml.Models::DelegateModel::modelIndex(int index)
 
@@ -534,22 +694,26 @@ int QQmlDelegateModel::count() const
     return d->m_compositor.count(d->m_compositorGroup);
 }
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(
+        QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
+    Q_Q(QQmlDelegateModel);
     QQmlDelegateModel::ReleaseFlags stat = nullptr;
     if (!object)
         return stat;
 
     if (QQmlDelegateModelItem *cacheItem = QQmlDelegateModelItem::dataForObject(object)) {
         if (cacheItem->releaseObject()) {
-            cacheItem->destroyObject();
-            emitDestroyingItem(object);
-            if (cacheItem->incubationTask) {
-                releaseIncubator(cacheItem->incubationTask);
-                cacheItem->incubationTask = nullptr;
+            if (reusableFlag == QQmlInstanceModel::Reusable && isReusable(cacheItem)) {
+                removeCacheItem(cacheItem);
+                cacheItem->poolTime = 0;
+                m_reusableItemsPool.append(cacheItem);
+                emit q->itemPooled(cacheItem->index, object);
+                stat |= QQmlInstanceModel::Pooled;
+            } else {
+                destroyCacheItem(cacheItem);
+                stat |= QQmlInstanceModel::Destroyed;
             }
-            cacheItem->Dispose();
-            stat |= QQmlInstanceModel::Destroyed;
         } else {
             stat |= QQmlDelegateModel::Referenced;
         }
@@ -557,17 +721,115 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
     return stat;
 }
 
+void QQmlDelegateModelPrivate::destroyCacheItem(QQmlDelegateModelItem *cacheItem)
+{
+    QObject *object = cacheItem->object;
+    cacheItem->destroyObject();
+    emitDestroyingItem(object);
+    if (cacheItem->incubationTask) {
+        releaseIncubator(cacheItem->incubationTask);
+        cacheItem->incubationTask = nullptr;
+    }
+    cacheItem->Dispose();
+}
+
+/*
+  An item can be parked in the reuse pool if its object has finished incubating,
+  nothing but the object itself holds a script reference to it and its data can
+  be rebound to another model index without recreating the delegate.
+*/
+bool QQmlDelegateModelPrivate::isReusable(QQmlDelegateModelItem *cacheItem) const
+{
+    return cacheItem->object
+            && !cacheItem->incubationTask
+            && cacheItem->scriptRef == 1
+            && isCreatedFromDelegate(cacheItem->object, m_delegate)
+            && !(cacheItem->groups & Compositor::UnresolvedFlag)
+            && !qmlobject_cast<QQuickPackage *>(cacheItem->object)
+            && cacheItem->isReusable();
+}
+
+/*
+  The pool is emptied when the delegate changes, but objects created from the
+  previous delegate can still be released afterwards. They are recognized by
+  the component the object creator instantiated them from. Also used by
+  QQmlTableInstanceModel.
+*/
+bool QQmlDelegateModelPrivate::isCreatedFromDelegate(QObject *object, QQmlComponent *delegate)
+{
+    if (!object || !delegate)
+        return false;
+    QQmlData *ddata = QQmlData::get(object);
+    QQmlContextData *context = ddata ? ddata->outerContext : nullptr;
+    QQmlComponentPrivate *cp = QQmlComponentPrivate::get(delegate);
+    return context && cp->compilationUnit
+            && context->typeCompilationUnit.data() == cp->compilationUnit.data()
+            && context->componentObjectIndex == qMax(cp->start, 0);
+}
+
+QQmlDelegateModelItem *QQmlDelegateModelPrivate::takeReusableItem()
+{
+    // The most recently pooled item is the least likely to be drained next.
+    return m_reusableItemsPool.isEmpty() ? nullptr : m_reusableItemsPool.takeLast();
+}
+
+void QQmlDelegateModelPrivate::reuseItem(QQmlDelegateModelItem *cacheItem, Compositor::iterator it, int index)
+{
+    Q_Q(QQmlDelegateModel);
+
+    // Always rebind, the item doesn't receive change notifications while it is pooled.
+    cacheItem->rebindIndex(m_adaptorModel, it.modelIndex(), it.modelIndex(), 0);
+
+    if (QQmlDelegateModelAttached *attached = cacheItem->attached) {
+        for (int i = 1; i < m_groupCount; ++i)
+            attached->m_currentIndex[i] = it.index[i];
+        attached->emitChanges();
+    }
+
+    emit q->itemReused(index, cacheItem->object);
+}
+
+void QQmlDelegateModelPrivate::drainReusableItemsPool(int maxPoolTime)
+{
+    // Items that have been parked for longer than maxPoolTime calls are destroyed.
+    for (int i = 0; i < m_reusableItemsPool.count();) {
+        QQmlDelegateModelItem *cacheItem = m_reusableItemsPool.at(i);
+        if (++cacheItem->poolTime <= maxPoolTime) {
+            ++i;
+            continue;
+        }
+        m_reusableItemsPool.removeAt(i);
+        destroyCacheItem(cacheItem);
+    }
+}
+
 /*
   Returns ReleaseStatus flags.
+
+  If \a reusableFlag is Reusable the delegate object may be parked in a pool
+  instead of being destroyed, and handed out again by a later call to object()
+  for any index, in which case itemReused() is emitted.
 */
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     Q_D(QQmlDelegateModel);
-    QQmlInstanceModel::ReleaseFlags stat = d->release(item);
+    QQmlInstanceModel::ReleaseFlags stat = d->release(item, reusableFlag);
     return stat;
 }
 
+void QQmlDelegateModel::drainReusableItemsPool(int maxPoolTime)
+{
+    Q_D(QQmlDelegateModel);
+    d->drainReusableItemsPool(maxPoolTime);
+}
+
+int QQmlDelegateModel::poolSize()
+{
+    Q_D(QQmlDelegateModel);
+    return d->m_reusableItemsPool.count();
+}
+
 // Cancel a requested async item
 void QQmlDelegateModel::cancel(int index)
 {
@@ -945,6 +1207,28 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
 
     QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex) : 0;
 
+    if (!cacheItem && it.list<QQmlAdaptorModel>() == &m_adaptorModel) {
+        if (m_prefetchCount > 0)
+            prefetch(it.modelIndex());
+
+        if ((cacheItem = takeReusableItem())) {
+            // The pooled object has already been incubated, move it back into the
+            // cache and rebind it to its new index.
+            cacheItem->groups = it->flags;
+
+            m_cache.insert(it.cacheIndex, cacheItem);
+            m_compositor.setFlags(it, 1, Compositor::CacheFlag);
+            Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
+
+            cacheItem->referenceObject();
+            reuseItem(cacheItem, it, index);
+
+            if (index == m_compositor.count(group) - 1)
+                requestMoreIfNecessary();
+            return cacheItem->object;
+        }
+    }
+
     if (!cacheItem) {
         cacheItem = m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
         if (!cacheItem)
@@ -1126,6 +1410,322 @@ void QQmlDelegateModelPrivate::setGroups(
     emitChanges();
 }
 
+int QQmlDelegateModelPrivate::filteredGroups() const
+{
+    int groupFlags = 0;
+    for (int i = Compositor::MinimumGroupCount; i < m_groupCount; ++i) {
+        if (QQmlDelegateModelGroupPrivate::get(m_groups[i])->isFiltered())
+            groupFlags |= 1 << i;
+    }
+    return groupFlags;
+}
+
+/*
+    Updates the membership of the filtered groups in \a groupFlags for \a count items starting
+    at \a index in the items group.  The changes are recorded but not emitted.
+*/
+void QQmlDelegateModelPrivate::filterItems(int index, int count, int groupFlags)
+{
+    struct Run { int index; int count; int addFlags; int removeFlags; };
+    QVector<Run> runs;
+
+    for (int i = index; i < index + count; ++i) {
+        Compositor::iterator it = m_compositor.find(Compositor::Default, i);
+        // Items inserted from script aren't part of the model, leave them where they were put.
+        if (it.list<QQmlAdaptorModel>() != &m_adaptorModel)
+            continue;
+
+        int addFlags = 0;
+        int removeFlags = 0;
+        for (int group = Compositor::MinimumGroupCount; group < m_groupCount; ++group) {
+            if (!(groupFlags & (1 << group)))
+                continue;
+            QQmlDelegateModelGroupPrivate *groupPrivate = QQmlDelegateModelGroupPrivate::get(m_groups[group]);
+            const bool accepted = groupPrivate->filterAccepts(
+                        m_adaptorModel.value(it.modelIndex(), groupPrivate->filterRole));
+            if (accepted && !it->inGroup(group))
+                addFlags |= 1 << group;
+            else if (!accepted && it->inGroup(group))
+                removeFlags |= 1 << group;
+        }
+        if (!addFlags && !removeFlags)
+            continue;
+
+        if (!runs.isEmpty()) {
+            Run &last = runs.last();
+            if (last.index + last.count == i && last.addFlags == addFlags && last.removeFlags == removeFlags) {
+                ++last.count;
+                continue;
+            }
+        }
+        runs.append(Run { i, 1, addFlags, removeFlags });
+    }
+
+    // Changing the membership of other groups doesn't affect the indexes in the items group, so
+    // the runs remain valid as they are applied.
+    for (const Run &run : qAsConst(runs)) {
+        if (run.addFlags) {
+            QVector<Compositor::Insert> inserts;
+            m_compositor.setFlags(Compositor::Default, run.index, run.count, run.addFlags, &inserts);
+            itemsInserted(inserts);
+        }
+        if (run.removeFlags) {
+            QVector<Compositor::Remove> removes;
+            m_compositor.clearFlags(Compositor::Default, run.index, run.count, run.removeFlags, &removes);
+            itemsRemoved(removes);
+        }
+    }
+}
+
+namespace {
+
+struct SortKey
+{
+    QVariant value;
+    int modelIndex;
+    int index;
+};
+
+class SortKeyLessThan
+{
+public:
+    explicit SortKeyLessThan(Qt::SortOrder order) : order(order) {}
+
+    bool operator()(const SortKey &left, const SortKey &right) const
+    {
+        // Invalid values go last in either order, and equal values stay in model order.
+        if (left.value.isValid() != right.value.isValid())
+            return left.value.isValid();
+        if (valueLessThan(left.value, right.value))
+            return order == Qt::AscendingOrder;
+        if (valueLessThan(right.value, left.value))
+            return order == Qt::DescendingOrder;
+        if (left.modelIndex != right.modelIndex)
+            return left.modelIndex < right.modelIndex;
+        return left.index < right.index;
+    }
+
+private:
+    static bool isNumber(int type)
+    {
+        switch (type) {
+        case QMetaType::Bool:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::Float:
+        case QMetaType::Double:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static bool valueLessThan(const QVariant &left, const QVariant &right)
+    {
+        const int type = left.userType();
+        if (type == right.userType()) {
+            switch (type) {
+            case QMetaType::Int:
+                return left.toInt() < right.toInt();
+            case QMetaType::LongLong:
+                return left.toLongLong() < right.toLongLong();
+            case QMetaType::UInt:
+            case QMetaType::ULongLong:
+                return left.toULongLong() < right.toULongLong();
+            case QMetaType::QDate:
+                return left.toDate() < right.toDate();
+            case QMetaType::QTime:
+                return left.toTime() < right.toTime();
+            case QMetaType::QDateTime:
+                return left.toDateTime() < right.toDateTime();
+            default:
+                break;
+            }
+        }
+        if (isNumber(type) && isNumber(right.userType()))
+            return left.toDouble() < right.toDouble();
+        return left.toString() < right.toString();
+    }
+
+    Qt::SortOrder order;
+};
+
+class SortTask : public QRunnable
+{
+public:
+    SortTask(SortKey *begin, SortKey *end, const SortKeyLessThan &lessThan, QSemaphore *done)
+        : begin(begin), end(end), lessThan(lessThan), done(done)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        std::sort(begin, end, lessThan);
+        done->release();
+    }
+
+private:
+    SortKey *begin;
+    SortKey *end;
+    SortKeyLessThan lessThan;
+    QSemaphore *done;
+};
+
+/*
+    Sorts large sets of keys in chunks on the global thread pool and merges the sorted chunks.
+    Chunks for which no thread is available are sorted on the calling thread.
+*/
+void sortKeys(QVector<SortKey> *keys, const SortKeyLessThan &lessThan)
+{
+    enum { MinimumChunkSize = 4096 };
+
+    SortKey *begin = keys->data();
+    const int count = keys->count();
+    const int chunkCount = qMin(QThread::idealThreadCount(), count / MinimumChunkSize);
+    if (chunkCount < 2) {
+        std::sort(begin, begin + count, lessThan);
+        return;
+    }
+
+    QVarLengthArray<SortKey *, 17> bounds;
+    for (int i = 0; i <= chunkCount; ++i)
+        bounds.append(begin + int(qint64(count) * i / chunkCount));
+
+    QSemaphore done;
+    QVarLengthArray<SortTask *, 16> tasks;
+    for (int i = 1; i < chunkCount; ++i) {
+        SortTask *task = new SortTask(bounds[i], bounds[i + 1], lessThan, &done);
+        tasks.append(task);
+        if (!QThreadPool::globalInstance()->tryStart(task))
+            task->run();
+    }
+    std::sort(bounds[0], bounds[1], lessThan);
+    done.acquire(chunkCount - 1);
+    qDeleteAll(tasks);
+
+    for (int width = 1; width < chunkCount; width *= 2) {
+        for (int i = 0; i + width < chunkCount; i += 2 * width)
+            std::inplace_merge(bounds[i], bounds[i + width], bounds[qMin(i + 2 * width, chunkCount)], lessThan);
+    }
+}
+
+}
+
+/*
+    Moves the items in the items group into the order of the sort role.  If \a changed is not
+    empty, only the items whose bits are set are expected to be out of order; they are sorted on
+    their own and merged with the others.  The changes are recorded but not emitted.
+*/
+void QQmlDelegateModelPrivate::sortItems(const QBitArray &changed)
+{
+    const int count = m_compositor.count(Compositor::Default);
+    if (count < 2)
+        return;
+
+    QVector<SortKey> keys;
+    QVector<SortKey> changedKeys;
+    keys.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        Compositor::iterator it = m_compositor.find(Compositor::Default, i);
+        QVariant value;
+        int modelIndex = INT_MAX;
+        if (it.list<QQmlAdaptorModel>() == &m_adaptorModel) {
+            modelIndex = it.modelIndex();
+            value = m_adaptorModel.value(modelIndex, m_sortRole);
+            // Only basic types are compared off the GUI thread.
+            if (value.userType() == qMetaTypeId<QJSValue>())
+                value = value.value<QJSValue>().toVariant();
+            if (value.userType() >= QMetaType::User)
+                value = value.toString();
+        }
+        if (i < changed.size() && changed.testBit(i))
+            changedKeys.append(SortKey { value, modelIndex, i });
+        else
+            keys.append(SortKey { value, modelIndex, i });
+    }
+
+    const SortKeyLessThan lessThan(m_sortOrder);
+    // Items moved from script can leave the unchanged items out of order as well.
+    if (changed.isEmpty() || !std::is_sorted(keys.cbegin(), keys.cend(), lessThan)) {
+        keys += changedKeys;
+        sortKeys(&keys, lessThan);
+    } else {
+        std::sort(changedKeys.begin(), changedKeys.end(), lessThan);
+        const int unchangedCount = keys.count();
+        keys += changedKeys;
+        std::inplace_merge(keys.begin(), keys.begin() + unchangedCount, keys.end(), lessThan);
+    }
+
+    QVector<int> order;
+    order.reserve(count);
+    for (const SortKey &key : qAsConst(keys))
+        order.append(key.index);
+    moveItems(order);
+}
+
+/*
+    Moves the items in the items group so that the item at index order[i] ends up at index i.
+*/
+void QQmlDelegateModelPrivate::moveItems(const QVector<int> &order)
+{
+    const int count = order.count();
+
+    // Items are placed front to back, which leaves the items yet to be placed in their original
+    // order after the placed ones.  The current index of an item is then its target index plus the
+    // number of unplaced items originally before it, which a Fenwick tree counts in log time.
+    QVector<int> unplaced(count + 1);
+    for (int i = 1; i <= count; ++i) {
+        unplaced[i] += 1;
+        const int parent = i + (i & -i);
+        if (parent <= count)
+            unplaced[parent] += unplaced[i];
+    }
+
+    for (int to = 0; to < count;) {
+        const int index = order.at(to);
+
+        // Items that were adjacent and stay adjacent are moved together.
+        int moveCount = 1;
+        while (to + moveCount < count && order.at(to + moveCount) == index + moveCount)
+            ++moveCount;
+
+        int from = to;
+        for (int i = index; i > 0; i -= i & -i)
+            from += unplaced.at(i);
+
+        if (from != to) {
+            QVector<Compositor::Remove> removes;
+            QVector<Compositor::Insert> inserts;
+            m_compositor.move(
+                    Compositor::Default, from, Compositor::Default, to, moveCount, Compositor::Default,
+                    &removes, &inserts);
+            itemsMoved(removes, inserts);
+        }
+
+        for (int placed = index; placed < index + moveCount; ++placed) {
+            for (int i = placed + 1; i <= count; i += i & -i)
+                unplaced[i] -= 1;
+        }
+        to += moveCount;
+    }
+}
+
+template <typename Change>
+static QBitArray changedItems(const QVector<Change> &changes, int count)
+{
+    QBitArray changed(count);
+    for (const Change &change : changes) {
+        if (change.inGroup(Compositor::Default)) {
+            const int index = change.index[Compositor::Default];
+            changed.fill(true, index, index + change.count);
+        }
+    }
+    return changed;
+}
+
 bool QQmlDelegateModel::event(QEvent *e)
 {
     Q_D(QQmlDelegateModel);
@@ -1136,6 +1736,8 @@ bool QQmlDelegateModel::event(QEvent *e)
         d->m_incubatorCleanupScheduled = false;
         qDeleteAll(d->m_finishedIncubating);
         d->m_finishedIncubating.clear();
+    } else if (d->m_adaptorModel.prefetched(e, d->m_cache)) {
+        return true;
     }
     return QQmlInstanceModel::event(e);
 }
@@ -1165,10 +1767,19 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
     if (count <= 0 || !d->m_complete)
         return;
 
-    if (d->m_adaptorModel.notify(d->m_cache, index, count, roles)) {
+    const int filteredGroups = d->filteredGroups();
+    const bool notify = d->m_adaptorModel.notify(d->m_cache, index, count, roles);
+    if (notify || filteredGroups || d->isSorted()) {
         QVector<Compositor::Change> changes;
         d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
-        d->itemsChanged(changes);
+        if (notify)
+            d->itemsChanged(changes);
+        for (const Compositor::Change &change : qAsConst(changes)) {
+            if (filteredGroups && change.inGroup(Compositor::Default))
+                d->filterItems(change.index[Compositor::Default], change.count, filteredGroups);
+        }
+        if (d->isSorted())
+            d->sortItems(changedItems(changes, d->m_compositor.count(Compositor::Default)));
         d->emitChanges();
     }
 }
@@ -1258,6 +1869,7 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
 {
 
     Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
     if (count <= 0 || !d->m_complete)
         return;
 
@@ -1273,6 +1885,14 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsInserted(inserts);
+    if (const int filteredGroups = d->filteredGroups()) {
+        for (const Compositor::Insert &insert : qAsConst(inserts)) {
+            if (insert.inGroup(Compositor::Default))
+                d->filterItems(insert.index[Compositor::Default], insert.count, filteredGroups);
+        }
+    }
+    if (d->isSorted())
+        d->sortItems(changedItems(inserts, d->m_compositor.count(Compositor::Default)));
     d->emitChanges();
 }
 
@@ -1396,6 +2016,7 @@ void QQmlDelegateModelPrivate::itemsRemoved(const QVector<Compositor::Remove> &r
 void QQmlDelegateModel::_q_itemsRemoved(int index, int count)
 {
     Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
     if (count <= 0|| !d->m_complete)
         return;
 
@@ -1446,6 +2067,7 @@ void QQmlDelegateModelPrivate::itemsMoved(
 void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
 {
     Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
     if (count <= 0 || !d->m_complete)
         return;
 
@@ -1466,6 +2088,8 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsMoved(&d->m_adaptorModel, from, to, count, &removes, &inserts);
     d->itemsMoved(removes, inserts);
+    if (d->isSorted())
+        d->sortItems();
     d->emitChanges();
 }
 
@@ -1503,6 +2127,7 @@ void QQmlDelegateModelPrivate::emitChanges()
 void QQmlDelegateModel::_q_modelReset()
 {
     Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
     if (!d->m_delegate)
         return;
 
@@ -1526,6 +2151,10 @@ void QQmlDelegateModel::_q_modelReset()
         if (d->m_count)
             d->m_compositor.listItemsInserted(&d->m_adaptorModel, 0, d->m_count, &inserts);
         d->itemsMoved(removes, inserts);
+        if (const int filteredGroups = d->filteredGroups())
+            d->filterItems(0, d->m_compositor.count(Compositor::Default), filteredGroups);
+        if (d->isSorted())
+            d->sortItems();
         d->m_reset = true;
 
         if (d->m_adaptorModel.canFetchMore())
@@ -1546,6 +2175,7 @@ void QQmlDelegateModel::_q_rowsInserted(const QModelIndex &parent, int begin, in
 void QQmlDelegateModel::_q_rowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end)
 {
     Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
     if (!d->m_adaptorModel.rootIndex.isValid())
         return;
     const QModelIndex index = d->m_adaptorModel.rootIndex;
@@ -1563,6 +2193,12 @@ void QQmlDelegateModel::_q_rowsAboutToBeRemoved(const QModelIndex &parent, int b
     }
 }
 
+void QQmlDelegateModel::_q_modelAboutToBeChanged()
+{
+    Q_D(QQmlDelegateModel);
+    d->m_adaptorModel.clearPrefetched();
+}
+
 void QQmlDelegateModel::_q_rowsRemoved(const QModelIndex &parent, int begin, int end)
 {
     Q_D(QQmlDelegateModel);
@@ -1918,6 +2554,9 @@ QQmlDelegateModelItem::QQmlDelegateModelItem(
     , scriptRef(0)
     , groups(0)
     , index(modelIndex)
+    , row(modelIndex)
+    , column(0)
+    , poolTime(0)
 {
     metaType->addref();
 }
@@ -2141,6 +2780,8 @@ void QQmlDelegateModelAttached::setGroups(const QStringList &groups)
 
     const int groupFlags = model->m_cacheMetaType->parseGroups(groups);
     const int cacheIndex = model->m_cache.indexOf(m_cacheItem);
+    if (cacheIndex == -1) // parked in the reuse pool
+        return;
     Compositor::iterator it = model->m_compositor.find(Compositor::Cache, cacheIndex);
     model->setGroups(it, 1, Compositor::Cache, groupFlags);
 }
@@ -2425,6 +3066,106 @@ void QQmlDelegateModelGroup::setDefaultInclude(bool include)
     }
 }
 
+/*!
+    \qmlproperty string QtQml.Models::DelegateModelGroup::filterRole
+    \since 5.11
+
+    This property holds the name of the model role used to decide which items belong to the
+    group.
+
+    When set, every item in the \l {DelegateModel::items}{items} group whose value for this role
+    matches \l filterValue is added to the group, and every other model item is removed from it.
+    Membership is kept up to date as items are inserted into the model and as the role's value
+    changes.  The role is read directly from the model, so no delegate items are created and no
+    JavaScript is run for the items being filtered.
+
+    \code
+    DelegateModel {
+        groups: DelegateModelGroup { id: fruitGroup; name: "fruit"; filterRole: "type"; filterValue: "Fruit" }
+        filterOnGroup: "fruit"
+    }
+    \endcode
+
+    Setting the role to an empty string, which is the default, stops filtering and leaves the
+    current members of the group as they are.
+*/
+
+QString QQmlDelegateModelGroup::filterRole() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filterRole;
+}
+
+void QQmlDelegateModelGroup::setFilterRole(const QString &role)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->filterRole == role)
+        return;
+
+    d->filterRole = role;
+    d->refilter();
+    emit filterRoleChanged();
+}
+
+/*!
+    \qmlproperty var QtQml.Models::DelegateModelGroup::filterValue
+    \since 5.11
+
+    This property holds the value that \l filterRole is matched against.
+
+    If the value is a regular expression, items whose role value contains a match belong to the
+    group.  If it is a list, items whose role value is equal to any of the list's values belong to
+    the group.  Otherwise an item belongs to the group if its role value is equal to the filter
+    value.
+*/
+
+QVariant QQmlDelegateModelGroup::filterValue() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filterValue;
+}
+
+void QQmlDelegateModelGroup::setFilterValue(const QVariant &value)
+{
+    Q_D(QQmlDelegateModelGroup);
+    const QVariant filterValue = value.userType() == qMetaTypeId<QJSValue>()
+            ? value.value<QJSValue>().toVariant()
+            : value;
+    if (d->filterValue == filterValue && d->filterValue.userType() == filterValue.userType())
+        return;
+
+    d->filterValue = filterValue;
+    d->refilter();
+    emit filterValueChanged();
+}
+
+bool QQmlDelegateModelGroupPrivate::filterAccepts(const QVariant &value) const
+{
+    switch (filterValue.userType()) {
+    case QMetaType::QRegExp:
+        return filterValue.toRegExp().indexIn(value.toString()) != -1;
+    case QMetaType::QRegularExpression:
+        return filterValue.toRegularExpression().match(value.toString()).hasMatch();
+    case QMetaType::QVariantList:
+        return filterValue.toList().contains(value);
+    default:
+        return value == filterValue;
+    }
+}
+
+void QQmlDelegateModelGroupPrivate::refilter()
+{
+    if (!model || !isFiltered())
+        return;
+
+    QQmlDelegateModelPrivate *modelPrivate = QQmlDelegateModelPrivate::get(model);
+    if (!modelPrivate->m_complete)
+        return;
+
+    modelPrivate->filterItems(0, modelPrivate->m_compositor.count(Compositor::Default), 1 << group);
+    modelPrivate->emitChanges();
+}
+
 /*!
     \qmlmethod object QtQml.Models::DelegateModelGroup::get(int index)
 
@@ -3157,7 +3898,7 @@ QObject *QQmlPartsModel::object(int index, QQmlIncubator::IncubationMode incubat
     return nullptr;
 }
 
-QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item)
+QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item, ReusableFlag)
 {
     QQmlInstanceModel::ReleaseFlags flags = nullptr;
 
@@ -88,6 +88,9 @@ class Q_QML_PRIVATE_EXPORT QQmlDelegateModel : public QQmlInstanceModel, public
     Q_PROPERTY(QQmlListProperty<QQmlDelegateModelGroup> groups READ groups CONSTANT)
     Q_PROPERTY(QObject *parts READ parts CONSTANT)
     Q_PROPERTY(QVariant rootIndex READ rootIndex WRITE setRootIndex NOTIFY rootIndexChanged)
+    Q_PROPERTY(int prefetchCount READ prefetchCount WRITE setPrefetchCount NOTIFY prefetchCountChanged REVISION 11)
+    Q_PROPERTY(QString sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged REVISION 11)
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged REVISION 11)
     Q_CLASSINFO("DefaultProperty", "delegate")
     Q_INTERFACES(QQmlParserStatus)
 public:
@@ -107,13 +110,22 @@ public:
     QVariant rootIndex() const;
     void setRootIndex(const QVariant &root);
 
+    int prefetchCount() const;
+    void setPrefetchCount(int count);
+
+    QString sortRole() const;
+    void setSortRole(const QString &role);
+
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder order);
+
     Q_INVOKABLE QVariant modelIndex(int idx) const;
     Q_INVOKABLE QVariant parentModelIndex() const;
 
     int count() const override;
     bool isValid() const override { return delegate() != nullptr; }
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *object) override;
+    ReleaseFlags release(QObject *object, ReusableFlag reusableFlag = NotReusable) override;
     void cancel(int index) override;
     QString stringValue(int index, const QString &role) override;
     void setWatchedRoles(const QList<QByteArray> &roles) override;
@@ -121,6 +133,9 @@ public:
 
     int indexOf(QObject *object, QObject *objectContext) const override;
 
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override;
+
     QString filterGroup() const;
     void setFilterGroup(const QString &group);
     void resetFilterGroup();
@@ -138,6 +153,9 @@ Q_SIGNALS:
     void filterGroupChanged();
     void defaultGroupsChanged();
     void rootIndexChanged();
+    Q_REVISION(11) void prefetchCountChanged();
+    Q_REVISION(11) void sortRoleChanged();
+    Q_REVISION(11) void sortOrderChanged();
 
 private Q_SLOTS:
     void _q_itemsChanged(int index, int count, const QVector<int> &roles);
@@ -147,6 +165,7 @@ private Q_SLOTS:
     void _q_modelReset();
     void _q_rowsInserted(const QModelIndex &,int,int);
     void _q_rowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end);
+    void _q_modelAboutToBeChanged();
     void _q_rowsRemoved(const QModelIndex &,int,int);
     void _q_rowsMoved(const QModelIndex &, int, int, const QModelIndex &, int);
     void _q_dataChanged(const QModelIndex&,const QModelIndex&,const QVector<int> &);
@@ -165,6 +184,8 @@ class Q_QML_PRIVATE_EXPORT QQmlDelegateModelGroup : public QObject
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
     Q_PROPERTY(bool includeByDefault READ defaultInclude WRITE setDefaultInclude NOTIFY defaultIncludeChanged)
+    Q_PROPERTY(QString filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged REVISION 11)
+    Q_PROPERTY(QVariant filterValue READ filterValue WRITE setFilterValue NOTIFY filterValueChanged REVISION 11)
 public:
     QQmlDelegateModelGroup(QObject *parent = nullptr);
     QQmlDelegateModelGroup(const QString &name, QQmlDelegateModel *model, int compositorType, QObject *parent = nullptr);
@@ -178,6 +199,12 @@ public:
     bool defaultInclude() const;
     void setDefaultInclude(bool include);
 
+    QString filterRole() const;
+    void setFilterRole(const QString &role);
+
+    QVariant filterValue() const;
+    void setFilterValue(const QVariant &value);
+
     Q_INVOKABLE QQmlV4Handle get(int index);
 
 public Q_SLOTS:
@@ -194,6 +221,8 @@ Q_SIGNALS:
     void countChanged();
     void nameChanged();
     void defaultIncludeChanged();
+    Q_REVISION(11) void filterRoleChanged();
+    Q_REVISION(11) void filterValueChanged();
     void changed(const QQmlV4Handle &removed, const QQmlV4Handle &inserted);
 private:
     Q_DECLARE_PRIVATE(QQmlDelegateModelGroup)
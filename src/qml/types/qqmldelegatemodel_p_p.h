@@ -45,6 +45,7 @@
 
 #include <QtQml/qqmlcontext.h>
 #include <QtQml/qqmlincubator.h>
+#include <QtCore/qbitarray.h>
 
 #include <private/qqmladaptormodel_p.h>
 #include <private/qqmlopenmetaobject_p.h>
@@ -121,13 +122,19 @@ public:
     int groupIndex(Compositor::Group group);
 
     int modelIndex() const { return index; }
-    void setModelIndex(int idx) { index = idx; Q_EMIT modelIndexChanged(); }
+    void setModelIndex(int idx) { setModelIndex(idx, idx, 0); }
+    void setModelIndex(int idx, int newRow, int newColumn) {
+        index = idx; row = newRow; column = newColumn; Q_EMIT modelIndexChanged(); }
 
     virtual QV4::ReturnedValue get() { return QV4::QObjectWrapper::wrap(v4, this); }
 
     virtual void setValue(const QString &role, const QVariant &value) { Q_UNUSED(role); Q_UNUSED(value); }
     virtual bool resolveIndex(const QQmlAdaptorModel &, int) { return false; }
 
+    virtual bool isReusable() const { return false; }
+    virtual void rebindIndex(const QQmlAdaptorModel &, int idx, int newRow, int newColumn) {
+        setModelIndex(idx, newRow, newColumn); }
+
     static QV4::ReturnedValue get_model(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
     static QV4::ReturnedValue get_groups(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
     static QV4::ReturnedValue set_groups(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
@@ -145,6 +152,9 @@ public:
     int scriptRef;
     int groups;
     int index;
+    int row;
+    int column;
+    int poolTime;
 
 Q_SIGNALS:
     void modelIndexChanged();
@@ -233,11 +243,17 @@ public:
     bool parseGroupArgs(
             QQmlV4Function *args, Compositor::Group *group, int *index, int *count, int *groups) const;
 
+    bool isFiltered() const { return !filterRole.isEmpty(); }
+    bool filterAccepts(const QVariant &value) const;
+    void refilter();
+
     Compositor::Group group;
     QPointer<QQmlDelegateModel> model;
     QQmlDelegateModelGroupEmitterList emitters;
     QQmlChangeSet changeSet;
     QString name;
+    QString filterRole;
+    QVariant filterValue;
     bool defaultInclude;
 };
 
@@ -258,8 +274,16 @@ public:
     void connectModel(QQmlAdaptorModel *model);
 
     void requestMoreIfNecessary();
+    void prefetch(int modelIndex);
     QObject *object(Compositor::Group group, int index, QQmlIncubator::IncubationMode incubationMode);
-    QQmlDelegateModel::ReleaseFlags release(QObject *object);
+    QQmlDelegateModel::ReleaseFlags release(
+            QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
+    void destroyCacheItem(QQmlDelegateModelItem *cacheItem);
+    bool isReusable(QQmlDelegateModelItem *cacheItem) const;
+    static bool isCreatedFromDelegate(QObject *object, QQmlComponent *delegate);
+    QQmlDelegateModelItem *takeReusableItem();
+    void reuseItem(QQmlDelegateModelItem *cacheItem, Compositor::iterator it, int index);
+    void drainReusableItemsPool(int maxPoolTime);
     QString stringValue(Compositor::Group group, int index, const QString &name);
     void emitCreatedPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
     void emitInitPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
@@ -290,6 +314,11 @@ public:
     void itemsMoved(
             const QVector<Compositor::Remove> &removes, const QVector<Compositor::Insert> &inserts);
     void itemsChanged(const QVector<Compositor::Change> &changes);
+    int filteredGroups() const;
+    void filterItems(int index, int count, int groupFlags);
+    bool isSorted() const { return !m_sortRole.isEmpty(); }
+    void sortItems(const QBitArray &changed = QBitArray());
+    void moveItems(const QVector<int> &order);
     void emitChanges();
     void emitModelUpdated(const QQmlChangeSet &changeSet, bool reset) override;
 
@@ -312,15 +341,20 @@ public:
     QQmlDelegateModelGroupEmitterList m_pendingParts;
 
     QList<QQmlDelegateModelItem *> m_cache;
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
     QList<QQDMIncubationTask *> m_finishedIncubating;
     QList<QByteArray> m_watchedRoles;
 
     QString m_filterGroup;
+    QString m_sortRole;
 
     int m_count;
     int m_groupCount;
+    int m_prefetchCount;
+    int m_lastPrefetchIndex;
 
     QQmlListCompositor::Group m_compositorGroup;
+    Qt::SortOrder m_sortOrder;
     bool m_complete : 1;
     bool m_delegateValidated : 1;
     bool m_reset : 1;
@@ -355,7 +389,7 @@ public:
     int count() const override;
     bool isValid() const override;
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *item) override;
+    ReleaseFlags release(QObject *item, ReusableFlag reusableFlag = NotReusable) override;
     QString stringValue(int index, const QString &role) override;
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
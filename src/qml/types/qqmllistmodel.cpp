@@ -211,6 +211,24 @@ ListLayout::Role::~Role()
     delete subLayout;
 }
 
+QString ListLayout::Role::intern(const QString &value) const
+{
+    // Only short values are worth sharing; long ones rarely repeat and
+    // would make every lookup expensive.
+    enum { MaxInternedLength = 64, MaxInternedStrings = 4096 };
+
+    if (value.size() > MaxInternedLength)
+        return value;
+
+    QSet<QString>::const_iterator it = internedStrings.constFind(value);
+    if (it != internedStrings.constEnd())
+        return *it;
+
+    if (internedStrings.size() < MaxInternedStrings)
+        internedStrings.insert(value);
+    return value;
+}
+
 const ListLayout::Role *ListLayout::getRoleOrCreate(const QString &key, const QVariant &data)
 {
     Role::DataType type;
@@ -321,15 +339,24 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         s.targetIndex -= rowsRemoved;
         if (s.src == nullptr) {
             Q_ASSERT(s.targetIndex == i);
+            // remove consecutive elements with a single notification
+            int removeCount = 1;
+            while (i + removeCount < target->elements.count()
+                   && !elementHash.find(target->elements.at(i + removeCount)->getUid()).value().src) {
+                ++removeCount;
+            }
             hasChanges = true;
             if (targetModel)
-                targetModel->beginRemoveRows(QModelIndex(), i, i);
-            s.target->destroy(target->m_layout);
-            target->elements.removeOne(s.target);
-            delete s.target;
+                targetModel->beginRemoveRows(QModelIndex(), i, i + removeCount - 1);
+            for (int j = 0; j < removeCount; ++j) {
+                ListElement *removed = target->elements.at(i + j);
+                removed->destroy(target->m_layout);
+                delete removed;
+            }
+            target->elements.remove(i, removeCount);
             if (targetModel)
                 targetModel->endRemoveRows();
-            ++rowsRemoved;
+            rowsRemoved += removeCount;
             --i;
             continue;
         }
@@ -366,6 +393,9 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     //
     // to ensure things are kept in the correct order, emit inserts and moves first. This shouls ensure all persistent
     // model indices are updated correctly
+    //
+    // consecutive inserted rows and consecutive changed rows are each reported with a single notification
+    QQmlListModel::ChangedRange changed;
     int rowsInserted = 0;
     for (int i = 0 ; i < target->elements.count() ; ++i) {
         ListElement *element = target->elements.at(i);
@@ -373,25 +403,35 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         Q_ASSERT(s.srcIndex >= 0);
         s.srcIndex += rowsInserted;
         if (s.srcIndex != s.targetIndex) {
-            if (targetModel) {
-                if (s.targetIndex == -1) {
-                    targetModel->beginInsertRows(QModelIndex(), i, i);
+            changed.flush(targetModel);
+            if (s.targetIndex == -1) {
+                int insertCount = 1;
+                while (i + insertCount < target->elements.count()
+                       && elementHash.find(target->elements.at(i + insertCount)->getUid()).value().targetIndex == -1) {
+                    ++insertCount;
+                }
+                if (targetModel) {
+                    targetModel->beginInsertRows(QModelIndex(), i, i + insertCount - 1);
                     targetModel->endInsertRows();
-                } else {
-                    targetModel->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
-                    targetModel->endMoveRows();
                 }
+                hasChanges = true;
+                rowsInserted += insertCount;
+                i += insertCount - 1;
+                continue;
+            }
+            if (targetModel) {
+                targetModel->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
+                targetModel->endMoveRows();
             }
             hasChanges = true;
             ++rowsInserted;
         }
         if (s.targetIndex != -1 && !s.changedRoles.isEmpty()) {
-            QModelIndex idx = targetModel->createIndex(i, 0);
-            if (targetModel)
-                targetModel->dataChanged(idx, idx, s.changedRoles);
+            changed.add(targetModel, i, s.changedRoles);
             hasChanges = true;
         }
     }
+    changed.flush(targetModel);
     return hasChanges;
 }
 
@@ -423,6 +463,17 @@ void ListModel::insertElement(int index)
     updateCacheIndices(index);
 }
 
+void ListModel::insertElements(int index, int count)
+{
+    if (count <= 0)
+        return;
+
+    elements.insertBlank(index, count);
+    for (int i = 0; i < count; ++i)
+        elements[index + i] = new ListElement;
+    updateCacheIndices(index + count);
+}
+
 void ListModel::move(int from, int to, int n)
 {
     if (from > to) {
@@ -881,11 +932,12 @@ int ListElement::setStringProperty(const ListLayout::Role &role, const QString &
         QString *c = reinterpret_cast<QString *>(mem);
         bool changed;
         if (c->data_ptr() == nullptr) {
-            new (mem) QString(s);
+            new (mem) QString(role.intern(s));
             changed = true;
         } else {
             changed = c->compare(s) != 0;
-            *c = s;
+            if (changed)
+                *c = role.intern(s);
         }
         if (changed)
             roleIndex = role.index;
@@ -1052,7 +1104,7 @@ int ListElement::setFunctionProperty(const ListLayout::Role &role, const QJSValu
 void ListElement::setStringPropertyFast(const ListLayout::Role &role, const QString &s)
 {
     char *mem = getPropertyMemory(role);
-    new (mem) QString(s);
+    new (mem) QString(role.intern(s));
 }
 
 void ListElement::setDoublePropertyFast(const ListLayout::Role &role, double d)
@@ -1133,6 +1185,8 @@ void ListElement::clearProperty(const ListLayout::Role &role)
     }
 }
 
+Q_STATIC_ASSERT(sizeof(ListElement) == 64);
+
 ListElement::ListElement()
 {
     m_objectCache = nullptr;
@@ -1921,12 +1975,19 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
         s.targetIndex -= rowsRemoved;
         if (s.src == nullptr) {
             Q_ASSERT(s.targetIndex == i);
+            // remove consecutive elements with a single notification
+            int removeCount = 1;
+            while (i + removeCount < target->m_modelObjects.count()
+                   && !elementHash.find(target->m_modelObjects.at(i + removeCount)->getUid()).value().src) {
+                ++removeCount;
+            }
             hasChanges = true;
-            target->beginRemoveRows(QModelIndex(), i, i);
-            target->m_modelObjects.remove(i, 1);
+            target->beginRemoveRows(QModelIndex(), i, i + removeCount - 1);
+            const QVector<DynamicRoleModelNode *> removed = target->m_modelObjects.mid(i, removeCount);
+            target->m_modelObjects.remove(i, removeCount);
             target->endRemoveRows();
-            delete s.target;
-            ++rowsRemoved;
+            qDeleteAll(removed);
+            rowsRemoved += removeCount;
             --i;
             continue;
         }
@@ -1951,6 +2012,9 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
     //
     // to ensure things are kept in the correct order, emit inserts and moves first. This shouls ensure all persistent
     // model indices are updated correctly
+    //
+    // consecutive inserted rows and consecutive changed rows are each reported with a single notification
+    ChangedRange changed;
     int rowsInserted = 0;
     for (int i = 0 ; i < target->m_modelObjects.count() ; ++i) {
         DynamicRoleModelNode *element = target->m_modelObjects.at(i);
@@ -1958,25 +2022,56 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
         Q_ASSERT(s.srcIndex >= 0);
         s.srcIndex += rowsInserted;
         if (s.srcIndex != s.targetIndex) {
+            changed.flush(target);
             if (s.targetIndex == -1) {
-                target->beginInsertRows(QModelIndex(), i, i);
+                int insertCount = 1;
+                while (i + insertCount < target->m_modelObjects.count()
+                       && elementHash.find(target->m_modelObjects.at(i + insertCount)->getUid()).value().targetIndex == -1) {
+                    ++insertCount;
+                }
+                target->beginInsertRows(QModelIndex(), i, i + insertCount - 1);
                 target->endInsertRows();
-            } else {
-                target->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
-                target->endMoveRows();
+                hasChanges = true;
+                rowsInserted += insertCount;
+                i += insertCount - 1;
+                continue;
             }
+            target->beginMoveRows(QModelIndex(), i, i, QModelIndex(), s.srcIndex);
+            target->endMoveRows();
             hasChanges = true;
             ++rowsInserted;
         }
         if (s.targetIndex != -1 && !s.changedRoles.isEmpty()) {
-            QModelIndex idx = target->createIndex(i, 0);
-            emit target->dataChanged(idx, idx, s.changedRoles);
+            changed.add(target, i, s.changedRoles);
             hasChanges = true;
         }
     }
+    changed.flush(target);
     return hasChanges;
 }
 
+void QQmlListModel::ChangedRange::add(QQmlListModel *model, int index, const QVector<int> &changedRoles)
+{
+    if (first >= 0 && index != last + 1)
+        flush(model);
+    if (first < 0)
+        first = index;
+    last = index;
+    for (int role : changedRoles) {
+        if (!roles.contains(role))
+            roles.append(role);
+    }
+}
+
+void QQmlListModel::ChangedRange::flush(QQmlListModel *model)
+{
+    if (first >= 0 && model)
+        model->emitItemsChanged(first, last - first + 1, roles);
+    first = -1;
+    last = -1;
+    roles.clear();
+}
+
 void QQmlListModel::emitItemsChanged(int index, int count, const QVector<int> &roles)
 {
     if (count <= 0)
@@ -2242,14 +2337,19 @@ void QQmlListModel::insert(QQmlV4Function *args)
             QV4::ScopedObject argObject(scope);
 
             int objectArrayLength = objectArray->getLength();
+            if (objectArrayLength <= 0)
+                return;
+
             emitItemsAboutToBeInserted(index, objectArrayLength);
+            if (!m_dynamicRoles)
+                m_listModel->insertElements(index, objectArrayLength);
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
                     m_modelObjects.insert(index+i, DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
                 } else {
-                    m_listModel->insert(index+i, argObject);
+                    m_listModel->set(index+i, argObject);
                 }
             }
             emitItemsInserted();
@@ -2355,13 +2455,18 @@ void QQmlListModel::append(QQmlV4Function *args)
                 int index = count();
                 emitItemsAboutToBeInserted(index, objectArrayLength);
 
+                if (m_dynamicRoles)
+                    m_modelObjects.reserve(index + objectArrayLength);
+                else
+                    m_listModel->insertElements(index, objectArrayLength);
+
                 for (int i=0 ; i < objectArrayLength ; ++i) {
                     argObject = objectArray->getIndexed(i);
 
                     if (m_dynamicRoles) {
                         m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
                     } else {
-                        m_listModel->append(argObject);
+                        m_listModel->set(index + i, argObject);
                     }
                 }
 
@@ -2460,6 +2565,16 @@ QQmlV4Handle QQmlListModel::get(int index) const
     If \a index is equal to count() then a new item is appended to the
     list. Otherwise, \a index must be an element in the list.
 
+    Since Qt 5.11, \a dict may also be an array of objects. The items
+    starting at \a index are changed to the values of the objects in
+    turn, and any objects that reach past the end of the list are
+    appended. Views are notified of all the changes at once, rather than
+    once per item:
+
+    \code
+        fruitModel.set(0, [{"cost": 1.95}, {"cost": 2.45}, {"cost": 3.25}])
+    \endcode
+
     \sa append()
 */
 void QQmlListModel::set(int index, const QQmlV4Handle &handle)
@@ -2476,6 +2591,12 @@ void QQmlListModel::set(int index, const QQmlV4Handle &handle)
         return;
     }
 
+    QV4::ScopedArrayObject objectArray(scope, object);
+    if (objectArray) {
+        setRange(index, objectArray);
+        return;
+    }
+
 
     if (index == count()) {
         emitItemsAboutToBeInserted(index, 1);
@@ -2502,6 +2623,56 @@ void QQmlListModel::set(int index, const QQmlV4Handle &handle)
     }
 }
 
+void QQmlListModel::setRange(int index, QV4::ArrayObject *objectArray)
+{
+    QV4::Scope scope(engine());
+    QV4::ScopedObject argObject(scope);
+
+    const int objectArrayLength = objectArray->getLength();
+    const int changeCount = qMin(objectArrayLength, count() - index);
+
+    // Change the existing items first and notify them as a single range.
+    QVector<int> changedRoles;
+    QVector<int> roles;
+    for (int i = 0; i < changeCount; ++i) {
+        argObject = objectArray->getIndexed(i);
+        if (!argObject)
+            continue;
+
+        roles.clear();
+        if (m_dynamicRoles)
+            m_modelObjects[index + i]->updateValues(scope.engine->variantMapFromJS(argObject), roles);
+        else
+            m_listModel->set(index + i, argObject, &roles);
+
+        for (int role : qAsConst(roles)) {
+            if (!changedRoles.contains(role))
+                changedRoles.append(role);
+        }
+    }
+    if (!changedRoles.isEmpty())
+        emitItemsChanged(index, changeCount, changedRoles);
+
+    // Then append whatever reaches past the end of the list.
+    const int insertIndex = index + changeCount;
+    const int insertCount = objectArrayLength - changeCount;
+    if (insertCount <= 0)
+        return;
+
+    emitItemsAboutToBeInserted(insertIndex, insertCount);
+    if (!m_dynamicRoles)
+        m_listModel->insertElements(insertIndex, insertCount);
+    for (int i = 0; i < insertCount; ++i) {
+        argObject = objectArray->getIndexed(changeCount + i);
+
+        if (m_dynamicRoles)
+            m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
+        else
+            m_listModel->set(insertIndex + i, argObject);
+    }
+    emitItemsInserted();
+}
+
 /*!
     \qmlmethod ListModel::setProperty(int index, string property, variant value)
 
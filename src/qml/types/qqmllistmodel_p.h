@@ -73,6 +73,7 @@ class ListLayout;
 
 namespace QV4 {
 struct ModelObject;
+struct ArrayObject;
 }
 
 class Q_QML_PRIVATE_EXPORT QQmlListModel : public QAbstractListModel
@@ -153,6 +154,17 @@ private:
         QVector<int> changedRoles;
     };
 
+    // Accumulates changes to consecutive rows into a single dataChanged().
+    struct ChangedRange
+    {
+        void add(QQmlListModel *model, int index, const QVector<int> &changedRoles);
+        void flush(QQmlListModel *model);
+
+        int first = -1;
+        int last = -1;
+        QVector<int> roles;
+    };
+
     static bool sync(QQmlListModel *src, QQmlListModel *target);
     static QQmlListModel *createWithOwner(QQmlListModel *newOwner);
 
@@ -161,6 +173,7 @@ private:
     void emitItemsInserted();
 
     void removeElements(int index, int removeCount);
+    void setRange(int index, QV4::ArrayObject *objectArray);
 };
 
 // ### FIXME
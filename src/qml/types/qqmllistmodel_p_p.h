@@ -56,6 +56,7 @@
 #include <private/qqmlopenmetaobject_p.h>
 #include <private/qv4qobjectwrapper_p.h>
 #include <qqml.h>
+#include <QtCore/qset.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -223,12 +224,18 @@ public:
             MaxDataType
         };
 
+        QString intern(const QString &value) const;
+
         QString name;
         DataType type;
         int blockIndex;
         int blockOffset;
         int index;
         ListLayout *subLayout;
+
+    private:
+        // Values of a string role tend to repeat across elements, share their storage.
+        mutable QSet<QString> internedStrings;
     };
 
     const Role *getRoleOrCreate(const QString &key, const QVariant &data);
@@ -315,9 +322,9 @@ private:
     ModelNodeMetaObject *objectCache();
 
     char data[BLOCK_SIZE];
-    ListElement *next;
-
     int uid;
+
+    ListElement *next;
     QObject *m_objectCache;
 
     friend class ListModel;
@@ -376,6 +383,7 @@ public:
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
 
     void move(int from, int to, int n);
 
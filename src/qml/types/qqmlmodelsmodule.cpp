@@ -56,6 +56,8 @@ void QQmlModelsModule::defineModule()
 #if QT_CONFIG(qml_delegate_model)
     qmlRegisterType<QQmlDelegateModel>(uri, 2, 1, "DelegateModel");
     qmlRegisterType<QQmlDelegateModelGroup>(uri, 2, 1, "DelegateModelGroup");
+    qmlRegisterType<QQmlDelegateModel, 11>(uri, 2, 11, "DelegateModel");
+    qmlRegisterType<QQmlDelegateModelGroup, 11>(uri, 2, 11, "DelegateModelGroup");
 #endif
     qmlRegisterType<QQmlObjectModel>(uri, 2, 1, "ObjectModel");
     qmlRegisterType<QQmlObjectModel,3>(uri, 2, 3, "ObjectModel");
@@ -0,0 +1,495 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qqmltableinstancemodel_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtQml/qqmlinfo.h>
+
+#include <private/qqmlchangeset_p.h>
+#include <private/qqmlcomponent_p.h>
+#include <private/qqmlincubator_p.h>
+
+QT_BEGIN_NAMESPACE
+
+void QQmlTableInstanceModelIncubationTask::setInitialState(QObject *object)
+{
+    incubating->object = object;
+    emit tableInstanceModel->initItem(incubating->index, object);
+}
+
+void QQmlTableInstanceModelIncubationTask::statusChanged(QQmlIncubator::Status status)
+{
+    if (tableInstanceModel) {
+        tableInstanceModel->incubationTaskStatusChanged(this, status);
+    } else {
+        // The model was deleted while incubating, let the base class clean up
+        QQDMIncubationTask::statusChanged(status);
+    }
+}
+
+QQmlTableInstanceModel::QQmlTableInstanceModel(QQmlContext *qmlContext, QObject *parent)
+    : QQmlInstanceModel(*(new QObjectPrivate()), parent)
+    , m_qmlContext(qmlContext)
+    , m_metaType(new QQmlDelegateModelItemMetaType(qmlContext->engine()->handle(), nullptr, QStringList()))
+    , m_cleanupScheduled(false)
+{
+}
+
+QQmlTableInstanceModel::~QQmlTableInstanceModel()
+{
+    disconnectModel();
+
+    const QList<QQmlDelegateModelItem *> modelItems = m_modelItems.values() + m_reusableItemsPool;
+    for (QQmlDelegateModelItem *modelItem : modelItems) {
+        if (QQmlTableInstanceModelIncubationTask *task
+                = static_cast<QQmlTableInstanceModelIncubationTask *>(modelItem->incubationTask)) {
+            // The task cleans up the item once the incubation has finished
+            task->tableInstanceModel = nullptr;
+            modelItem->incubationTask = nullptr;
+            continue;
+        }
+        if (modelItem->object) {
+            delete modelItem->object;
+            modelItem->object = nullptr;
+            modelItem->contextData->invalidate();
+            modelItem->contextData = nullptr;
+        }
+        modelItem->scriptRef = 0;
+        modelItem->objectRef = 0;
+        delete modelItem;
+    }
+
+    qDeleteAll(m_finishedIncubationTasks);
+    m_metaType->release();
+}
+
+QVariant QQmlTableInstanceModel::model() const
+{
+    return m_adaptorModel.model();
+}
+
+void QQmlTableInstanceModel::setModel(const QVariant &model)
+{
+    disconnectModel();
+    m_adaptorModel.setModel(model, nullptr, m_qmlContext->engine());
+    connectModel();
+
+    emit modelUpdated(QQmlChangeSet(), /*reset*/true);
+    emit countChanged();
+
+    // Whatever the view released into the pool is bound to the old model
+    drainReusableItemsPool(0);
+}
+
+QQmlComponent *QQmlTableInstanceModel::delegate() const
+{
+    return m_delegate;
+}
+
+void QQmlTableInstanceModel::setDelegate(QQmlComponent *delegate)
+{
+    if (m_delegate == delegate)
+        return;
+
+    m_delegate = delegate;
+    emit modelUpdated(QQmlChangeSet(), /*reset*/true);
+    drainReusableItemsPool(0);
+}
+
+void QQmlTableInstanceModel::connectModel()
+{
+    QAbstractItemModel *aim = m_adaptorModel.aim();
+    if (!aim || !qobject_cast<QAbstractItemModel *>(m_adaptorModel.object()))
+        return;
+
+    // Every change of the table structure moves the flat index of most cells,
+    // so they are all reported as a reset.
+    static const char *structureSignals[] = {
+        SIGNAL(rowsInserted(QModelIndex,int,int)),
+        SIGNAL(rowsRemoved(QModelIndex,int,int)),
+        SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)),
+        SIGNAL(columnsInserted(QModelIndex,int,int)),
+        SIGNAL(columnsRemoved(QModelIndex,int,int)),
+        SIGNAL(columnsMoved(QModelIndex,int,int,QModelIndex,int)),
+        SIGNAL(modelReset()),
+        SIGNAL(layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint))
+    };
+    for (const char *signal : structureSignals)
+        connect(aim, signal, this, SLOT(modelStructureChanged()));
+    connect(aim, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)),
+            this, SLOT(modelDataChanged(QModelIndex,QModelIndex,QVector<int>)));
+}
+
+void QQmlTableInstanceModel::disconnectModel()
+{
+    if (QAbstractItemModel *aim = qobject_cast<QAbstractItemModel *>(m_adaptorModel.object()))
+        disconnect(aim, nullptr, this, nullptr);
+}
+
+/*
+  Returns the index of the cell at \a row and \a column, or -1 if the table
+  has too many cells for it to fit in an int.
+*/
+int QQmlTableInstanceModel::indexAt(int row, int column) const
+{
+    const qint64 index = qint64(row) * columns() + column;
+    return index <= INT_MAX ? int(index) : -1;
+}
+
+/*
+  Returns the cell of \a object, created by a QQmlTableInstanceModel, as
+  QPoint(column, row). Unlike the index passed along with the object by the
+  QQmlInstanceModel signals, this also works for cells of large tables.
+*/
+QPoint QQmlTableInstanceModel::cellOf(QObject *object)
+{
+    if (QQmlDelegateModelItem *modelItem = QQmlDelegateModelItem::dataForObject(object))
+        return QPoint(modelItem->column, modelItem->row);
+    return QPoint(-1, -1);
+}
+
+QObject *QQmlTableInstanceModel::object(int index, QQmlIncubator::IncubationMode incubationMode)
+{
+    if (index < 0 || index >= count()) {
+        qWarning() << "TableInstanceModel::object: index out of range" << index << count();
+        return nullptr;
+    }
+    return object(rowAt(index), columnAt(index), incubationMode);
+}
+
+QObject *QQmlTableInstanceModel::object(int row, int column, QQmlIncubator::IncubationMode incubationMode)
+{
+    if (!m_delegate || row < 0 || row >= rows() || column < 0 || column >= columns()) {
+        qWarning() << "TableInstanceModel::object: cell out of range" << row << column;
+        return nullptr;
+    } else if (!m_qmlContext || !m_qmlContext->isValid()) {
+        return nullptr;
+    }
+
+    const qint64 key = cellKey(row, column);
+    const int index = indexAt(row, column);
+
+    QQmlDelegateModelItem *modelItem = m_modelItems.value(key);
+    if (!modelItem) {
+        if ((modelItem = takeReusableItem())) {
+            // The pooled object has already been incubated, rebind it to the new cell
+            modelItem->rebindIndex(m_adaptorModel, index, row, column);
+            m_modelItems.insert(key, modelItem);
+            modelItem->referenceObject();
+            emit itemReused(index, modelItem->object);
+            return modelItem->object;
+        }
+
+        modelItem = m_adaptorModel.createItem(m_metaType, row);
+        if (!modelItem)
+            return nullptr;
+        modelItem->setModelIndex(index, row, column);
+        m_modelItems.insert(key, modelItem);
+    }
+
+    // Bump the reference counts temporarily so that the item is not deleted
+    // if the incubation finishes synchronously.
+    modelItem->scriptRef += 1;
+    modelItem->referenceObject();
+
+    if (modelItem->incubationTask) {
+        const bool sync = incubationMode == QQmlIncubator::Synchronous
+                || incubationMode == QQmlIncubator::AsynchronousIfNested;
+        if (sync && modelItem->incubationTask->incubationMode() == QQmlIncubator::Asynchronous)
+            modelItem->incubationTask->forceCompletion();
+    } else if (!modelItem->object) {
+        incubateModelItem(modelItem, incubationMode);
+    }
+
+    modelItem->scriptRef -= 1;
+    if (modelItem->object && !modelItem->incubationTask)
+        return modelItem->object;
+
+    modelItem->releaseObject();
+    if (!modelItem->incubationTask && modelItem->contextData) {
+        // The incubation failed synchronously, drop the reference it held
+        modelItem->contextData->invalidate();
+        modelItem->contextData = nullptr;
+        modelItem->scriptRef -= 1;
+    }
+    if (!modelItem->isReferenced()) {
+        m_modelItems.remove(key);
+        delete modelItem;
+    }
+    return nullptr;
+}
+
+void QQmlTableInstanceModel::incubateModelItem(QQmlDelegateModelItem *modelItem, QQmlIncubator::IncubationMode incubationMode)
+{
+    QQmlContext *creationContext = m_delegate->creationContext();
+
+    // Held for as long as the item has an object
+    modelItem->scriptRef += 1;
+    modelItem->incubationTask = new QQmlTableInstanceModelIncubationTask(this, modelItem, incubationMode);
+
+    QQmlContextData *ctxt = new QQmlContextData;
+    ctxt->setParent(QQmlContextData::get(creationContext ? creationContext : m_qmlContext.data()));
+    ctxt->contextObject = modelItem;
+    modelItem->contextData = ctxt;
+
+    if (m_adaptorModel.hasProxyObject()) {
+        if (QQmlAdaptorModelProxyInterface *proxy = qobject_cast<QQmlAdaptorModelProxyInterface *>(modelItem)) {
+            ctxt = new QQmlContextData;
+            ctxt->setParent(modelItem->contextData, /*stronglyReferencedByParent*/true);
+            ctxt->contextObject = proxy->proxiedObject();
+        }
+    }
+
+    QQmlComponentPrivate::get(m_delegate)->incubateObject(
+                modelItem->incubationTask,
+                m_delegate,
+                m_qmlContext->engine(),
+                ctxt,
+                QQmlContextData::get(m_qmlContext));
+}
+
+void QQmlTableInstanceModel::incubationTaskStatusChanged(QQmlTableInstanceModelIncubationTask *task, QQmlIncubator::Status status)
+{
+    if (status != QQmlIncubator::Ready && status != QQmlIncubator::Error)
+        return;
+
+    QQmlDelegateModelItem *modelItem = task->incubating;
+    modelItem->incubationTask = nullptr;
+    task->incubating = nullptr;
+    releaseIncubationTask(task);
+
+    // Items that were dropped by a reset while incubating are not announced
+    const qint64 key = cellKey(modelItem->row, modelItem->column);
+    const bool current = m_modelItems.value(key) == modelItem;
+
+    if (status == QQmlIncubator::Ready && current) {
+        modelItem->referenceObject();
+        emit createdItem(modelItem->index, modelItem->object);
+        modelItem->releaseObject();
+    } else if (status == QQmlIncubator::Error) {
+        qmlWarning(m_delegate, task->errors() + m_delegate->errors()) << "Error creating delegate";
+    }
+
+    if (!modelItem->isObjectReferenced()) {
+        if (current)
+            m_modelItems.remove(key);
+        if (modelItem->object) {
+            destroyModelItem(modelItem);
+        } else if (modelItem->contextData) {
+            modelItem->contextData->invalidate();
+            modelItem->contextData = nullptr;
+            modelItem->Dispose();
+        }
+    }
+}
+
+void QQmlTableInstanceModel::releaseIncubationTask(QQmlTableInstanceModelIncubationTask *task)
+{
+    // The task cannot be deleted from within its own status callback
+    if (!task->isError())
+        task->clear();
+    m_finishedIncubationTasks.append(task);
+    if (!m_cleanupScheduled) {
+        m_cleanupScheduled = true;
+        QCoreApplication::postEvent(this, new QEvent(QEvent::User));
+    }
+}
+
+bool QQmlTableInstanceModel::event(QEvent *e)
+{
+    if (e->type() == QEvent::User) {
+        m_cleanupScheduled = false;
+        qDeleteAll(m_finishedIncubationTasks);
+        m_finishedIncubationTasks.clear();
+    }
+    return QQmlInstanceModel::event(e);
+}
+
+void QQmlTableInstanceModel::destroyModelItem(QQmlDelegateModelItem *modelItem)
+{
+    QObject *object = modelItem->object;
+    modelItem->destroyObject();
+    emit destroyingItem(object);
+    modelItem->Dispose();
+}
+
+QQmlInstanceModel::ReleaseFlags QQmlTableInstanceModel::release(QObject *object, ReusableFlag reusableFlag)
+{
+    QQmlDelegateModelItem *modelItem = object ? QQmlDelegateModelItem::dataForObject(object) : nullptr;
+    if (!modelItem)
+        return nullptr;
+
+    if (!modelItem->releaseObject())
+        return QQmlInstanceModel::Referenced;
+
+    const qint64 key = cellKey(modelItem->row, modelItem->column);
+    if (m_modelItems.value(key) == modelItem)
+        m_modelItems.remove(key);
+
+    if (reusableFlag == Reusable
+            && !modelItem->incubationTask
+            && modelItem->scriptRef == 1
+            && QQmlDelegateModelPrivate::isCreatedFromDelegate(object, m_delegate)
+            && modelItem->isReusable()) {
+        modelItem->poolTime = 0;
+        m_reusableItemsPool.append(modelItem);
+        emit itemPooled(modelItem->index, object);
+        return QQmlInstanceModel::Pooled;
+    }
+
+    destroyModelItem(modelItem);
+    return QQmlInstanceModel::Destroyed;
+}
+
+QQmlDelegateModelItem *QQmlTableInstanceModel::takeReusableItem()
+{
+    return m_reusableItemsPool.isEmpty() ? nullptr : m_reusableItemsPool.takeLast();
+}
+
+void QQmlTableInstanceModel::drainReusableItemsPool(int maxPoolTime)
+{
+    for (int i = 0; i < m_reusableItemsPool.count();) {
+        QQmlDelegateModelItem *modelItem = m_reusableItemsPool.at(i);
+        if (++modelItem->poolTime <= maxPoolTime) {
+            ++i;
+            continue;
+        }
+        m_reusableItemsPool.removeAt(i);
+        destroyModelItem(modelItem);
+    }
+}
+
+void QQmlTableInstanceModel::cancel(int index)
+{
+    if (index >= 0 && index < count())
+        cancel(rowAt(index), columnAt(index));
+}
+
+void QQmlTableInstanceModel::cancel(int row, int column)
+{
+    const qint64 key = cellKey(row, column);
+    QQmlDelegateModelItem *modelItem = m_modelItems.value(key);
+    if (!modelItem || !modelItem->incubationTask || modelItem->isObjectReferenced())
+        return;
+
+    QQmlTableInstanceModelIncubationTask *task
+            = static_cast<QQmlTableInstanceModelIncubationTask *>(modelItem->incubationTask);
+    modelItem->incubationTask = nullptr;
+    task->incubating = nullptr;
+    releaseIncubationTask(task);
+
+    m_modelItems.remove(key);
+    if (modelItem->object) {
+        destroyModelItem(modelItem);
+    } else {
+        modelItem->contextData->invalidate();
+        modelItem->contextData = nullptr;
+        modelItem->Dispose();
+    }
+}
+
+QQmlIncubator::Status QQmlTableInstanceModel::incubationStatus(int index)
+{
+    if (index < 0 || index >= count())
+        return QQmlIncubator::Null;
+    return incubationStatus(rowAt(index), columnAt(index));
+}
+
+QQmlIncubator::Status QQmlTableInstanceModel::incubationStatus(int row, int column)
+{
+    QQmlDelegateModelItem *modelItem = m_modelItems.value(cellKey(row, column));
+    if (!modelItem)
+        return QQmlIncubator::Null;
+    if (modelItem->incubationTask)
+        return modelItem->incubationTask->status();
+    return modelItem->object ? QQmlIncubator::Ready : QQmlIncubator::Null;
+}
+
+QString QQmlTableInstanceModel::stringValue(int index, const QString &role)
+{
+    if (index < 0 || index >= count())
+        return QString();
+    if (QQmlDelegateModelItem *modelItem = m_modelItems.value(cellKey(rowAt(index), columnAt(index))))
+        return modelItem->property(role.toUtf8()).toString();
+    return QString();
+}
+
+int QQmlTableInstanceModel::indexOf(QObject *object, QObject *) const
+{
+    if (QQmlDelegateModelItem *modelItem = QQmlDelegateModelItem::dataForObject(object)) {
+        if (m_modelItems.value(cellKey(modelItem->row, modelItem->column)) == modelItem)
+            return modelItem->index;
+    }
+    return -1;
+}
+
+void QQmlTableInstanceModel::modelStructureChanged()
+{
+    // Let the view release what it holds, then forget about the items that
+    // are still incubating; they are destroyed when they finish.
+    emit modelUpdated(QQmlChangeSet(), /*reset*/true);
+    emit countChanged();
+
+    for (auto it = m_modelItems.begin(); it != m_modelItems.end();) {
+        if ((*it)->incubationTask && !(*it)->isObjectReferenced())
+            it = m_modelItems.erase(it);
+        else
+            ++it;
+    }
+}
+
+void QQmlTableInstanceModel::modelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (topLeft.parent() != m_adaptorModel.rootIndex || m_modelItems.isEmpty())
+        return;
+
+    // Notified one by one, as the indexes of the cells of large tables don't fit in an int
+    for (QQmlDelegateModelItem *modelItem : qAsConst(m_modelItems)) {
+        if (modelItem->row >= topLeft.row() && modelItem->row <= bottomRight.row()
+                && modelItem->column >= topLeft.column() && modelItem->column <= bottomRight.column()) {
+            m_adaptorModel.notify(QList<QQmlDelegateModelItem *>() << modelItem, modelItem->index, 1, roles);
+        }
+    }
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qqmltableinstancemodel_p.cpp"
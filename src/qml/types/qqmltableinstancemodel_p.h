@@ -0,0 +1,169 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQMLTABLEINSTANCEMODEL_P_H
+#define QQMLTABLEINSTANCEMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qpoint.h>
+
+#include <private/qqmldelegatemodel_p_p.h>
+
+QT_REQUIRE_CONFIG(qml_delegate_model);
+
+QT_BEGIN_NAMESPACE
+
+class QQmlTableInstanceModel;
+
+class QQmlTableInstanceModelIncubationTask : public QQDMIncubationTask
+{
+public:
+    QQmlTableInstanceModelIncubationTask(
+            QQmlTableInstanceModel *tableInstanceModel,
+            QQmlDelegateModelItem *modelItemToIncubate,
+            IncubationMode mode)
+        : QQDMIncubationTask(nullptr, mode)
+        , tableInstanceModel(tableInstanceModel)
+    {
+        incubating = modelItemToIncubate;
+    }
+
+    void statusChanged(Status status) override;
+    void setInitialState(QObject *object) override;
+
+    QQmlTableInstanceModel *tableInstanceModel;
+};
+
+/*
+  QQmlTableInstanceModel instantiates delegates for the cells of a two
+  dimensional model. Unlike QQmlDelegateModel it has no groups and no
+  compositor, and every structural change of the model is reported as a
+  reset.
+
+  Cells are identified by their row and column. The index of a cell seen
+  through QQmlInstanceModel is row * columns + column, which is -1 for cells
+  beyond what an int can count. Views of large tables use the row and column
+  based functions instead.
+*/
+class Q_QML_PRIVATE_EXPORT QQmlTableInstanceModel : public QQmlInstanceModel
+{
+    Q_OBJECT
+
+public:
+    QQmlTableInstanceModel(QQmlContext *qmlContext, QObject *parent = nullptr);
+    ~QQmlTableInstanceModel() override;
+
+    int count() const override { return int(qMin<qint64>(qint64(rows()) * columns(), INT_MAX)); }
+    int rows() const { return m_adaptorModel.rowCount(); }
+    int columns() const { return m_adaptorModel.columnCount(); }
+
+    int indexAt(int row, int column) const;
+    int rowAt(int index) const { return index / columns(); }
+    int columnAt(int index) const { return index % columns(); }
+
+    static qint64 cellKey(int row, int column) { return (qint64(row) << 32) | quint32(column); }
+    static QPoint cellAt(qint64 key) { return QPoint(int(quint32(key)), int(key >> 32)); }
+    static QPoint cellOf(QObject *object);
+
+    bool isValid() const override { return true; }
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *delegate);
+
+    QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
+    QObject *object(int row, int column, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
+    ReleaseFlags release(QObject *object, ReusableFlag reusableFlag = NotReusable) override;
+    void cancel(int index) override;
+    void cancel(int row, int column);
+    QQmlIncubator::Status incubationStatus(int index) override;
+    QQmlIncubator::Status incubationStatus(int row, int column);
+
+    QString stringValue(int index, const QString &role) override;
+    void setWatchedRoles(const QList<QByteArray> &) override {}
+
+    int indexOf(QObject *object, QObject *objectContext) const override;
+
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override { return m_reusableItemsPool.count(); }
+
+    bool event(QEvent *event) override;
+
+private Q_SLOTS:
+    void modelStructureChanged();
+    void modelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+
+private:
+    QQmlDelegateModelItem *takeReusableItem();
+    void incubateModelItem(QQmlDelegateModelItem *modelItem, QQmlIncubator::IncubationMode incubationMode);
+    void incubationTaskStatusChanged(QQmlTableInstanceModelIncubationTask *task, QQmlIncubator::Status status);
+    void releaseIncubationTask(QQmlTableInstanceModelIncubationTask *task);
+    void destroyModelItem(QQmlDelegateModelItem *modelItem);
+    void connectModel();
+    void disconnectModel();
+
+    QQmlAdaptorModel m_adaptorModel;
+    QPointer<QQmlComponent> m_delegate;
+    QPointer<QQmlContext> m_qmlContext;
+    QQmlDelegateModelItemMetaType *m_metaType;
+
+    QHash<qint64, QQmlDelegateModelItem *> m_modelItems; // By cellKey()
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
+    QList<QQmlTableInstanceModelIncubationTask *> m_finishedIncubationTasks;
+    bool m_cleanupScheduled;
+
+    friend class QQmlTableInstanceModelIncubationTask;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQMLTABLEINSTANCEMODEL_P_H
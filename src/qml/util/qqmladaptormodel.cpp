@@ -47,6 +47,12 @@
 #include <private/qv4value_p.h>
 #include <private/qv4functionobject_p.h>
 
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qthreadpool.h>
+
 QT_BEGIN_NAMESPACE
 
 class QQmlAdaptorModelEngineData : public QV8Engine::Deletable
@@ -106,6 +112,9 @@ public:
     void setValue(const QString &role, const QVariant &value) override;
     bool resolveIndex(const QQmlAdaptorModel &model, int idx) override;
 
+    bool isReusable() const override { return cachedData.isEmpty(); }
+    void rebindIndex(const QQmlAdaptorModel &model, int idx, int newRow, int newColumn) override;
+
     static QV4::ReturnedValue get_property(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
     static QV4::ReturnedValue set_property(const QV4::FunctionObject *, const QV4::Value *thisObject, const QV4::Value *argv, int argc);
 
@@ -203,9 +212,10 @@ public:
             RETURN_RESULT(scope.engine->throwTypeError(QStringLiteral("Not a valid VisualData object")));
 
         const QQmlAdaptorModel *const model = static_cast<QQmlDMCachedModelData *>(o->d()->item)->type->model;
-        if (o->d()->item->index >= 0 && *model) {
+        const QQmlDelegateModelItem *item = o->d()->item;
+        if (item->index >= 0 && *model) {
             const QAbstractItemModel * const aim = model->aim();
-            RETURN_RESULT(QV4::Encode(aim->hasChildren(aim->index(o->d()->item->index, 0, model->rootIndex))));
+            RETURN_RESULT(QV4::Encode(aim->hasChildren(aim->index(item->row, item->column, model->rootIndex))));
         } else {
             RETURN_RESULT(QV4::Encode(false));
         }
@@ -331,6 +341,7 @@ bool QQmlDMCachedModelData::resolveIndex(const QQmlAdaptorModel &, int idx)
     if (index == -1) {
         Q_ASSERT(idx >= 0);
         index = idx;
+        row = idx;
         cachedData.clear();
         emit modelIndexChanged();
         const QMetaObject *meta = metaObject();
@@ -343,6 +354,17 @@ bool QQmlDMCachedModelData::resolveIndex(const QQmlAdaptorModel &, int idx)
     }
 }
 
+void QQmlDMCachedModelData::rebindIndex(const QQmlAdaptorModel &, int idx, int newRow, int newColumn)
+{
+    // Role values are read from the model on demand, so it is enough to tell
+    // every binding on them that they may have changed.
+    setModelIndex(idx, newRow, newColumn);
+    const QMetaObject *meta = metaObject();
+    const int propertyCount = type->propertyRoles.count();
+    for (int i = 0; i < propertyCount; ++i)
+        QMetaObject::activate(this, meta, i, nullptr);
+}
+
 QV4::ReturnedValue QQmlDMCachedModelData::get_property(const QV4::FunctionObject *b, const QV4::Value *thisObject, const QV4::Value *, int)
 {
     QV4::Scope scope(b);
@@ -413,21 +435,18 @@ public:
     {
         if (index >= 0 && *type->model) {
             const QAbstractItemModel * const model = type->model->aim();
-            return model->hasChildren(model->index(index, 0, type->model->rootIndex));
+            return model->hasChildren(model->index(row, column, type->model->rootIndex));
         } else {
             return false;
         }
     }
 
-    QVariant value(int role) const override
-    {
-        return type->model->aim()->index(index, 0, type->model->rootIndex).data(role);
-    }
+    QVariant value(int role) const override;
 
     void setValue(int role, const QVariant &value) override
     {
         type->model->aim()->setData(
-                type->model->aim()->index(index, 0, type->model->rootIndex), value, role);
+                type->model->aim()->index(row, column, type->model->rootIndex), value, role);
     }
 
     QV4::ReturnedValue get() override
@@ -445,19 +464,286 @@ public:
     }
 };
 
+// Role values of a range of rows, fetched in one go ahead of the delegates
+// that read them.
+class QQmlDMPrefetchEvent : public QEvent
+{
+public:
+    QQmlDMPrefetchEvent(int id, int first, int count, const QVector<int> &roles)
+        : QEvent(eventType()), id(id), first(first), count(count), roles(roles) {}
+
+    static QEvent::Type eventType()
+    {
+        static const int type = QEvent::registerEventType();
+        return QEvent::Type(type);
+    }
+
+    static QVector<QVariant> fetch(
+            const QAbstractItemModel *model, const QModelIndex &parent,
+            int first, int count, const QVector<int> &roles)
+    {
+        QVector<QVariant> values;
+        values.reserve(count * roles.count());
+        for (int row = first; row < first + count; ++row) {
+            const QModelIndex index = model->index(row, 0, parent);
+            for (int role : roles)
+                values.append(index.data(role));
+        }
+        return values;
+    }
+
+    const int id;
+    const int first;
+    const int count;
+    const QVector<int> roles;
+    QVector<QVariant> values;   // Empty until fetched
+};
+
+// Shared by the data type and its worker tasks. The tasks only read from the
+// model while holding the lock, and stop once the model has been taken away.
+struct QQmlDMPrefetchGuard
+{
+    explicit QQmlDMPrefetchGuard(const QAbstractItemModel *model) : model(model) {}
+
+    QMutex mutex;
+    const QAbstractItemModel *model;
+};
+
+class QQmlDMPrefetchTask : public QRunnable
+{
+public:
+    QQmlDMPrefetchTask(
+            const QSharedPointer<QQmlDMPrefetchGuard> &guard, const QModelIndex &parent,
+            QObject *receiver, QQmlDMPrefetchEvent *event)
+        : guard(guard), parent(parent), receiver(receiver), event(event) {}
+
+    ~QQmlDMPrefetchTask() { delete event; }
+
+    void run() override
+    {
+        // Fetch row by row, so that the model can be taken away between rows
+        event->values.reserve(event->count * event->roles.count());
+        for (int row = event->first; row < event->first + event->count; ++row) {
+            QMutexLocker locker(&guard->mutex);
+            if (!guard->model)
+                return;
+            event->values += QQmlDMPrefetchEvent::fetch(guard->model, parent, row, 1, event->roles);
+        }
+        QCoreApplication::postEvent(receiver, event);
+        event = nullptr;
+    }
+
+private:
+    const QSharedPointer<QQmlDMPrefetchGuard> guard;
+    const QModelIndex parent;
+    QObject *receiver;
+    QQmlDMPrefetchEvent *event;
+};
+
 class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
 {
 public:
     VDMAbstractItemModelDataType(QQmlAdaptorModel *model)
         : VDMModelDelegateDataType(model)
+        , prefetchPool(nullptr)
+        , prefetchThreaded(false)
+    {
+    }
+
+    ~VDMAbstractItemModelDataType()
+    {
+        delete prefetchPool;
+    }
+
+    struct PrefetchedRow
+    {
+        PrefetchedRow() : id(0), pending(true), placeholderServed(false) {}
+
+        QVector<int> roles;
+        QVector<QVariant> values;
+        int id;
+        bool pending;
+        bool placeholderServed;
+    };
+
+    static bool hasThreadSafeData(const QAbstractItemModel *model)
+    {
+        const QMetaObject *metaObject = model->metaObject();
+        const int index = metaObject->indexOfClassInfo("ThreadSafeData");
+        return index != -1 && qstrcmp(metaObject->classInfo(index).value(), "true") == 0;
+    }
+
+    void prefetch(QQmlAdaptorModel &model, QObject *receiver, int index, int count) const override
+    {
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        if (!metaObject)
+            dataType->initializeMetaType(model);
+
+        // A negative count fetches the rows before index, for views moving backwards
+        const int rowCount = this->count(model);
+        const int step = count < 0 ? -1 : 1;
+        const int reach = qAbs(count);
+
+        // Wait until the view has used up half of the rows fetched ahead, so
+        // that the rows are requested in batches rather than one by one.
+        bool needed = false;
+        for (int i = 0, row = index; !needed && i < (reach + 1) / 2 && row >= 0 && row < rowCount; ++i, row += step)
+            needed = !prefetchedRows.contains(row);
+        if (!needed)
+            return;
+
+        const int first = qMax(0, count < 0 ? index - reach + 1 : index);
+        const int last = qMin(rowCount, count < 0 ? index + 1 : index + reach);
+        count = reach;
+
+        // Only request the part of the range that is not cached or requested yet
+        int begin = first;
+        while (begin < last && prefetchedRows.contains(begin))
+            ++begin;
+        int end = last;
+        while (end > begin && prefetchedRows.contains(end - 1))
+            --end;
+        if (begin >= end)
+            return;
+
+        // Keep the cache around the range that is being viewed
+        for (auto it = dataType->prefetchedRows.begin(); it != dataType->prefetchedRows.end();) {
+            if (!it->pending && (it.key() < first - count || it.key() >= last + count))
+                it = dataType->prefetchedRows.erase(it);
+            else
+                ++it;
+        }
+
+        // Until a delegate has read any role, fetch all of them
+        QVector<int> roles = usedRoles;
+        if (roles.isEmpty())
+            roles = propertyRoles.toVector();
+        if (roles.isEmpty())
+            return;
+
+        static QAtomicInt nextId;
+        PrefetchedRow row;
+        row.roles = roles;
+        row.id = nextId.fetchAndAddRelaxed(1) + 1;
+        for (int i = begin; i < end; ++i)
+            dataType->prefetchedRows.insert(i, row);
+
+        QQmlDMPrefetchEvent *event = new QQmlDMPrefetchEvent(row.id, begin, end - begin, roles);
+        dataType->prefetchThreaded = hasThreadSafeData(model.aim());
+        if (prefetchThreaded) {
+            if (!prefetchPool) {
+                dataType->prefetchPool = new QThreadPool;
+                prefetchPool->setMaxThreadCount(1);
+            }
+            if (!prefetchGuard)
+                dataType->prefetchGuard.reset(new QQmlDMPrefetchGuard(model.aim()));
+            prefetchPool->start(new QQmlDMPrefetchTask(prefetchGuard, model.rootIndex, receiver, event));
+        } else {
+            // Fetch on the GUI thread once the events of the current frame have been handled
+            QCoreApplication::postEvent(receiver, event, Qt::LowEventPriority);
+        }
+    }
+
+    bool prefetched(
+            QQmlAdaptorModel &model,
+            QEvent *e,
+            const QList<QQmlDelegateModelItem *> &items) const override
+    {
+        if (e->type() != QQmlDMPrefetchEvent::eventType())
+            return false;
+
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        QQmlDMPrefetchEvent *event = static_cast<QQmlDMPrefetchEvent *>(e);
+
+        // Rows that changed since the request are read from the model again
+        bool wanted = false;
+        for (int row = event->first; !wanted && row < event->first + event->count; ++row) {
+            const auto it = prefetchedRows.constFind(row);
+            wanted = it != prefetchedRows.cend() && it->id == event->id;
+        }
+        if (!wanted)
+            return true;
+
+        if (event->values.isEmpty()) {
+            event->values = QQmlDMPrefetchEvent::fetch(
+                        model.aim(), model.rootIndex, event->first, event->count, event->roles);
+        }
+
+        const int roleCount = event->roles.count();
+        int firstServed = -1;
+        int lastServed = -1;
+        for (int i = 0; i < event->count; ++i) {
+            const int row = event->first + i;
+            auto it = dataType->prefetchedRows.find(row);
+            if (it == dataType->prefetchedRows.end() || it->id != event->id)
+                continue;
+            it->values = event->values.mid(i * roleCount, roleCount);
+            it->pending = false;
+            if (it->placeholderServed) {
+                it->placeholderServed = false;
+                if (firstServed == -1)
+                    firstServed = row;
+                lastServed = row;
+            }
+        }
+
+        // Replace the placeholders handed out while the rows were being fetched
+        if (firstServed != -1)
+            VDMModelDelegateDataType::notify(model, items, firstServed, lastServed - firstServed + 1, event->roles);
+        return true;
+    }
+
+    void clearPrefetched(QQmlAdaptorModel &) const override
     {
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        dataType->prefetchedRows.clear();
+        dataType->cancelPrefetchTasks();
     }
 
+    // Called before the structure of the model changes. Waits for a row that is
+    // being read on the worker thread, and stops the tasks from reading more.
+    void cancelPrefetchTasks()
+    {
+        if (prefetchPool)
+            prefetchPool->clear();
+        if (prefetchGuard) {
+            QMutexLocker locker(&prefetchGuard->mutex);
+            prefetchGuard->model = nullptr;
+        }
+        prefetchGuard.reset();
+    }
+
+    bool notify(
+            const QQmlAdaptorModel &model,
+            const QList<QQmlDelegateModelItem *> &items,
+            int index,
+            int count,
+            const QVector<int> &roles) const override
+    {
+        if (!prefetchedRows.isEmpty()) {
+            VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+            for (int row = index; row < index + count; ++row)
+                dataType->prefetchedRows.remove(row);
+        }
+        return VDMModelDelegateDataType::notify(model, items, index, count, roles);
+    }
+
+    QHash<int, PrefetchedRow> prefetchedRows;
+    QVector<int> usedRoles;
+    QThreadPool *prefetchPool;
+    QSharedPointer<QQmlDMPrefetchGuard> prefetchGuard;
+    bool prefetchThreaded;
+
     int count(const QQmlAdaptorModel &model) const override
     {
         return model.aim()->rowCount(model.rootIndex);
     }
 
+    int columnCount(const QQmlAdaptorModel &model) const override
+    {
+        return model.aim()->columnCount(model.rootIndex);
+    }
+
     void cleanup(QQmlAdaptorModel &model, QQmlDelegateModel *vdm) const override
     {
         QAbstractItemModel * const aim = model.aim();
@@ -476,9 +762,23 @@ public:
                                 vdm, SLOT(_q_modelReset()));
             QObject::disconnect(aim, SIGNAL(layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
                                 vdm, SLOT(_q_layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)));
+            QObject::disconnect(aim, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)),
+                                vdm, SLOT(_q_modelAboutToBeChanged()));
+            QObject::disconnect(aim, SIGNAL(rowsAboutToBeMoved(QModelIndex,int,int,QModelIndex,int)),
+                                vdm, SLOT(_q_modelAboutToBeChanged()));
+            QObject::disconnect(aim, SIGNAL(modelAboutToBeReset()),
+                                vdm, SLOT(_q_modelAboutToBeChanged()));
+            QObject::disconnect(aim, SIGNAL(layoutAboutToBeChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
+                                vdm, SLOT(_q_modelAboutToBeChanged()));
         }
 
-        const_cast<VDMAbstractItemModelDataType *>(this)->release();
+        VDMAbstractItemModelDataType *dataType = const_cast<VDMAbstractItemModelDataType *>(this);
+        dataType->prefetchedRows.clear();
+        dataType->cancelPrefetchTasks();
+        if (prefetchPool)
+            prefetchPool->waitForDone();
+
+        dataType->release();
     }
 
     QVariant value(const QQmlAdaptorModel &model, int index, const QString &role) const override
@@ -558,6 +858,30 @@ public:
     }
 };
 
+QVariant QQmlDMAbstractItemModelData::value(int role) const
+{
+    VDMAbstractItemModelDataType *dataType = static_cast<VDMAbstractItemModelDataType *>(type);
+    if (!dataType->usedRoles.contains(role))
+        dataType->usedRoles.append(role);
+
+    if (!dataType->prefetchedRows.isEmpty() && column == 0) {
+        auto it = dataType->prefetchedRows.find(row);
+        if (it != dataType->prefetchedRows.end()) {
+            const int roleIndex = it->roles.indexOf(role);
+            if (roleIndex != -1 && !it->pending)
+                return it->values.at(roleIndex);
+            if (roleIndex != -1 && dataType->prefetchThreaded) {
+                // Don't block on a row that is being fetched on another thread,
+                // the delegate is notified once the data has arrived.
+                it->placeholderServed = true;
+                return QVariant();
+            }
+        }
+    }
+
+    return type->model->aim()->index(row, column, type->model->rootIndex).data(role);
+}
+
 //-----------------------------------------------------------------
 // QQmlListAccessor
 //-----------------------------------------------------------------
@@ -630,6 +954,7 @@ public:
     {
         if (index == -1) {
             index = idx;
+            row = idx;
             cachedData = model.list.at(idx);
             emit modelIndexChanged();
             emit modelDataChanged();
@@ -639,6 +964,15 @@ public:
         }
     }
 
+    bool isReusable() const override { return index != -1; }
+
+    void rebindIndex(const QQmlAdaptorModel &model, int idx, int newRow, int newColumn) override
+    {
+        cachedData = model.list.at(newRow);
+        setModelIndex(idx, newRow, newColumn);
+        emit modelDataChanged();
+    }
+
 
 Q_SIGNALS:
     void modelDataChanged();
@@ -915,6 +1249,10 @@ void QQmlAdaptorModel::setModel(const QVariant &variant, QQmlDelegateModel *vdm,
         if (QAbstractItemModel *model = qobject_cast<QAbstractItemModel *>(object)) {
             accessors = new VDMAbstractItemModelDataType(this);
 
+            // Models other than QQmlDelegateModel connect to the change signals themselves.
+            if (!vdm)
+                return;
+
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsInserted(QModelIndex,int,int)),
                               vdm, QQmlDelegateModel, SLOT(_q_rowsInserted(QModelIndex,int,int)));
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),
@@ -929,6 +1267,16 @@ void QQmlAdaptorModel::setModel(const QVariant &variant, QQmlDelegateModel *vdm,
                               vdm, QQmlDelegateModel, SLOT(_q_modelReset()));
             qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
                               vdm, QQmlDelegateModel, SLOT(_q_layoutChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)));
+
+            // Rows prefetched on a worker thread must not be read while the model changes.
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsAboutToBeInserted(QModelIndex,int,int)),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeChanged()));
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(rowsAboutToBeMoved(QModelIndex,int,int,QModelIndex,int)),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeChanged()));
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(modelAboutToBeReset()),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeChanged()));
+            qmlobject_connect(model, QAbstractItemModel, SIGNAL(layoutAboutToBeChanged(QList<QPersistentModelIndex>,QAbstractItemModel::LayoutChangeHint)),
+                              vdm, QQmlDelegateModel, SLOT(_q_modelAboutToBeChanged()));
         } else {
             accessors = new VDMObjectDelegateDataType;
         }
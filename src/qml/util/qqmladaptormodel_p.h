@@ -76,6 +76,7 @@ public:
         inline Accessors() {}
         virtual ~Accessors();
         virtual int count(const QQmlAdaptorModel &) const { return 0; }
+        virtual int columnCount(const QQmlAdaptorModel &) const { return 1; }
         virtual void cleanup(QQmlAdaptorModel &, QQmlDelegateModel * = nullptr) const {}
 
         virtual QVariant value(const QQmlAdaptorModel &, int, const QString &) const {
@@ -102,6 +103,13 @@ public:
             return QVariant(); }
         virtual bool canFetchMore(const QQmlAdaptorModel &) const { return false; }
         virtual void fetchMore(QQmlAdaptorModel &) const {}
+
+        virtual void prefetch(QQmlAdaptorModel &, QObject *, int, int) const {}
+        virtual bool prefetched(
+                QQmlAdaptorModel &,
+                QEvent *,
+                const QList<QQmlDelegateModelItem *> &) const { return false; }
+        virtual void clearPrefetched(QQmlAdaptorModel &) const {}
     };
 
     const Accessors *accessors;
@@ -121,6 +129,8 @@ public:
     inline const QAbstractItemModel *aim() const { return static_cast<const QAbstractItemModel *>(object()); }
 
     inline int count() const { return qMax(0, accessors->count(*this)); }
+    inline int rowCount() const { return count(); }
+    inline int columnCount() const { return qMax(0, accessors->columnCount(*this)); }
     inline QVariant value(int index, const QString &role) const {
         return accessors->value(*this, index, role); }
     inline QQmlDelegateModelItem *createItem(QQmlDelegateModelItemMetaType *metaType, int index) {
@@ -143,6 +153,12 @@ public:
     inline bool canFetchMore() const { return accessors->canFetchMore(*this); }
     inline void fetchMore() { return accessors->fetchMore(*this); }
 
+    inline void prefetch(QObject *receiver, int index, int count) {
+        accessors->prefetch(*this, receiver, index, count); }
+    inline bool prefetched(QEvent *event, const QList<QQmlDelegateModelItem *> &items) {
+        return accessors->prefetched(*this, event, items); }
+    inline void clearPrefetched() { accessors->clearPrefetched(*this); }
+
 protected:
     void objectDestroyed(QObject *) override;
 };
@@ -41,6 +41,8 @@
 
 #include <QtCore/qvarlengtharray.h>
 
+#include <algorithm>
+
 //#define QT_QML_VERIFY_MINIMAL
 //#define QT_QML_VERIFY_INTEGRITY
 
@@ -291,6 +293,7 @@ QQmlListCompositor::QQmlListCompositor()
     , m_defaultFlags(PrependFlag | DefaultFlag)
     , m_removeFlags(AppendFlag | PrependFlag | GroupMask)
     , m_moveId(0)
+    , m_checkpointsValid(false)
 {
 }
 
@@ -333,12 +336,68 @@ inline QQmlListCompositor::Range *QQmlListCompositor::erase(
     return next;
 }
 
+/*!
+    Rebuilds the checkpoints used by seek() to skip to a position in the list of ranges.
+*/
+
+void QQmlListCompositor::updateCheckpoints()
+{
+    m_checkpoints.clear();
+
+    iterator it(m_ranges.next, 0, Default, m_groupCount);
+    int rangeCount = 0;
+    for (; *it != &m_ranges; *it = it->next) {
+        if (rangeCount++ % CheckpointInterval == 0)
+            m_checkpoints.append(it);
+        it.incrementIndexes(it->count);
+    }
+    m_checkpointsValid = true;
+}
+
+/*!
+    Prepares the iterator \a it for moving to the item at \a index in a \a group, and returns
+    the offset it still has to be moved by.
+
+    Short distances are covered by walking the ranges from the current position of the iterator,
+    for longer ones the iterator is first moved to the closest checkpoint in front of \a index.
+    The checkpoints are rebuilt on demand after the compositor is modified.
+*/
+
+int QQmlListCompositor::seek(iterator *it, Group group, int index)
+{
+    it->setGroup(group);
+    int offset = index - it->index[group];
+
+    if (qAbs(offset) > CheckpointSeekDistance && index > 0) {
+        if (!m_checkpointsValid)
+            updateCheckpoints();
+
+        // Find the last checkpoint strictly before index, so the remaining offset is positive
+        // and the iterator never has to walk backwards.
+        QVector<iterator>::const_iterator checkpoint = std::lower_bound(
+                m_checkpoints.cbegin(), m_checkpoints.cend(), index,
+                [group](const iterator &lhs, int rhs) { return lhs.index[group] < rhs; });
+        if (checkpoint != m_checkpoints.cbegin()) {
+            --checkpoint;
+            const int checkpointOffset = index - checkpoint->index[group];
+            if (checkpointOffset < qAbs(offset)) {
+                *it = *checkpoint;
+                it->setGroup(group);
+                offset = checkpointOffset;
+            }
+        }
+    }
+
+    return offset;
+}
+
 /*!
     Sets the number (\a count) of possible groups that items may belong to in a compositor.
 */
 
 void QQmlListCompositor::setGroupCount(int count)
 {
+    invalidateCheckpoints();
     m_groupCount = count;
     m_end = iterator(&m_ranges, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -363,14 +422,9 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index < count(group));
-    if (m_cacheIt == m_end) {
+    if (m_cacheIt == m_end)
         m_cacheIt = iterator(m_ranges.next, 0, group, m_groupCount);
-        m_cacheIt += index;
-    } else {
-        const int offset = index - m_cacheIt.index[group];
-        m_cacheIt.setGroup(group);
-        m_cacheIt += offset;
-    }
+    m_cacheIt += seek(&m_cacheIt, group, index);
     Q_ASSERT(m_cacheIt.index[group] == index);
     Q_ASSERT(m_cacheIt->inGroup(group));
     QT_QML_VERIFY_LISTCOMPOSITOR
@@ -405,15 +459,11 @@ QQmlListCompositor::insert_iterator QQmlListCompositor::findInsertPosition(Group
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index <= count(group));
     insert_iterator it;
-    if (m_cacheIt == m_end) {
+    if (m_cacheIt == m_end)
         it = iterator(m_ranges.next, 0, group, m_groupCount);
-        it += index;
-    } else {
-        const int offset = index - m_cacheIt.index[group];
+    else
         it = m_cacheIt;
-        it.setGroup(group);
-        it += offset;
-    }
+    it += seek(&it, group, index);
     Q_ASSERT(it.index[group] == index);
     return it;
 }
@@ -460,6 +510,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         iterator before, void *list, int index, int count, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< before << list << index << count << flags)
+    invalidateCheckpoints();
     if (inserts) {
         inserts->append(Insert(before, count, flags & GroupMask));
     }
@@ -528,6 +579,7 @@ void QQmlListCompositor::setFlags(
         iterator from, int count, Group group, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< from << count << flags)
+    invalidateCheckpoints();
     if (!flags || !count)
         return;
 
@@ -638,6 +690,7 @@ void QQmlListCompositor::clearFlags(
         iterator from, int count, Group group, uint flags, QVector<Remove> *removes)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< from << count << flags)
+    invalidateCheckpoints();
     if (!flags || !count)
         return;
 
@@ -780,6 +833,7 @@ void QQmlListCompositor::move(
 
     // Find the position of the first item to move.
     iterator fromIt = find(fromGroup, from);
+    invalidateCheckpoints();
 
     if (fromIt != moveGroup) {
         // If the range at the from index doesn't contain items from the move group; skip
@@ -941,6 +995,7 @@ void QQmlListCompositor::move(
 void QQmlListCompositor::clear()
 {
     QT_QML_TRACE_LISTCOMPOSITOR("")
+    invalidateCheckpoints();
     for (Range *range = m_ranges.next; range != &m_ranges; range = erase(range)) {}
     m_end = iterator(m_ranges.next, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -953,6 +1008,7 @@ void QQmlListCompositor::listItemsInserted(
         const QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << insertions)
+    invalidateCheckpoints();
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
             // Skip ranges that don't reference list.
@@ -1076,6 +1132,7 @@ void QQmlListCompositor::listItemsRemoved(
         QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << *removals)
+    invalidateCheckpoints();
 
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
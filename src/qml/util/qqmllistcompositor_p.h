@@ -265,17 +265,27 @@ public:
             QVector<QQmlChangeSet::Change> *inserts);
 
 private:
+    // A sparse index of iterators to the start of every CheckpointInterval'th range, used to
+    // avoid walking long distances along the list of ranges in find().
+    enum { CheckpointInterval = 32, CheckpointSeekDistance = 128 };
+
     Range m_ranges;
     iterator m_end;
     iterator m_cacheIt;
+    QVector<iterator> m_checkpoints;
     int m_groupCount;
     int m_defaultFlags;
     int m_removeFlags;
     int m_moveId;
+    bool m_checkpointsValid;
 
     inline Range *insert(Range *before, void *list, int index, int count, uint flags);
     inline Range *erase(Range *range);
 
+    int seek(iterator *it, Group group, int index);
+    void updateCheckpoints();
+    void invalidateCheckpoints() { m_checkpointsValid = false; }
+
     struct MovedFlags
     {
         MovedFlags() {}
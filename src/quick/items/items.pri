@@ -120,6 +120,14 @@ qtConfig(quick-gridview) {
         $$PWD/qquickgridview.cpp
 }
 
+qtConfig(quick-tableview) {
+    HEADERS += \
+        $$PWD/qquicktableview_p.h \
+        $$PWD/qquicktableview_p_p.h
+    SOURCES += \
+        $$PWD/qquicktableview.cpp
+}
+
 qtConfig(quick-itemview) {
     HEADERS += \
         $$PWD/qquickitemview_p.h \
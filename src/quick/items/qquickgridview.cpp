@@ -1307,6 +1307,34 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlattachedsignal QtQuick::GridView::pooled()
+    \since 5.11
+
+    This attached signal is emitted after an item has been released from the
+    view and parked in the reuse pool, when \l reuseItems is \c true. The item
+    is hidden, but keeps its state; handlers can use it to stop timers or
+    animations that should not run while the item is not in use.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reused(), reuseItems
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::GridView::reused()
+    \since 5.11
+
+    This attached signal is emitted after a pooled item has been taken out of
+    the reuse pool and bound to a new model index. Bindings on \c index and the
+    model roles have already been updated when the signal is emitted, but any
+    other state the delegate holds has to be reset by the handler.
+
+    The corresponding handler is \c onReused.
+
+    \sa pooled(), reuseItems
+*/
+
 
 /*!
   \qmlproperty model QtQuick::GridView::model
@@ -1556,6 +1584,30 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     displayMarginBeginning or displayMarginEnd.
 */
 
+/*!
+    \qmlproperty bool QtQuick::GridView::reuseItems
+    \since 5.11
+
+    This property holds whether delegate items that move out of the view are
+    reused for items that move into it.
+
+    When \c true, a delegate item that is released is not destroyed but kept
+    in a pool, and handed out again the next time the view needs an item for
+    any index, instead of incubating a new one. This avoids the cost of
+    creating and destroying delegates while the grid is flicked. Items that have
+    not been reused by the time the view stops moving are destroyed.
+
+    A reused item keeps all its state apart from \c index and the model roles,
+    which are rebound to the new index. Delegates that hold other state must
+    reset it in the \l reused() attached signal handler. Items are only reused
+    with QAbstractItemModel based models, such as ListModel, and with integer
+    or array models.
+
+    The default value is \c false.
+
+    \sa pooled(), reused()
+*/
+
 /*!
     \qmlproperty int QtQuick::GridView::displayMarginBeginning
     \qmlproperty int QtQuick::GridView::displayMarginEnd
@@ -2047,6 +2099,8 @@ void QQuickGridView::viewportMoved(Qt::Orientations orient)
     }
 
     d->refillOrLayout();
+    if (d->reuseItems)
+        d->model->drainReusableItemsPool(QQuickItemViewPrivate::MaxReusePoolFrames);
 
     // Set visibility of items to eliminate cost of items outside the visible area.
     qreal from = d->isContentFlowReversed() ? -d->position()-d->displayMarginBeginning-d->size() : d->position()-d->displayMarginBeginning;
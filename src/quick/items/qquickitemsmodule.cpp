@@ -64,6 +64,9 @@
 #if QT_CONFIG(quick_pathview)
 #include "qquickpathview_p.h"
 #endif
+#if QT_CONFIG(quick_tableview)
+#include "qquicktableview_p.h"
+#endif
 #if QT_CONFIG(quick_viewtransitions)
 #include "qquickitemviewtransition_p.h"
 #endif
@@ -422,6 +425,24 @@ static void qt_quickitems_defineModule(const char *uri, int major, int minor)
     qmlRegisterType<QQuickAnimatedImage, 11>(uri, 2, 11,"AnimatedImage");
 #endif
     qmlRegisterType<QQuickItem, 11>(uri, 2, 11,"Item");
+#if QT_CONFIG(quick_listview)
+    qmlRegisterType<QQuickListView, 11>(uri, 2, 11, "ListView");
+#endif
+#if QT_CONFIG(quick_gridview)
+    qmlRegisterType<QQuickGridView, 11>(uri, 2, 11, "GridView");
+#endif
+#if QT_CONFIG(quick_itemview)
+    qmlRegisterUncreatableType<QQuickItemView, 11>(uri, 2, 11, itemViewName, itemViewMessage);
+#endif
+#if QT_CONFIG(quick_pathview)
+    qmlRegisterType<QQuickPathView, 11>(uri, 2, 11, "PathView");
+#endif
+#if QT_CONFIG(quick_repeater)
+    qmlRegisterType<QQuickRepeater, 11>(uri, 2, 11, "Repeater");
+#endif
+#if QT_CONFIG(quick_tableview)
+    qmlRegisterType<QQuickTableView>(uri, 2, 11, "TableView");
+#endif
 }
 
 static void initResources()
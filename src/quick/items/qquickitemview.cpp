@@ -796,6 +796,26 @@ void QQuickItemView::setHighlightMoveDuration(int duration)
     }
 }
 
+bool QQuickItemView::reuseItems() const
+{
+    Q_D(const QQuickItemView);
+    return d->reuseItems;
+}
+
+void QQuickItemView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickItemView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model) {
+        d->model->drainReusableItemsPool(0);
+        d->pooledItems.clear();
+    }
+    emit reuseItemsChanged();
+}
+
 QQuickTransition *QQuickItemView::populateTransition() const
 {
     Q_D(const QQuickItemView);
@@ -1319,6 +1339,8 @@ void QQuickItemView::animStopped()
     Q_D(QQuickItemView);
     d->bufferMode = QQuickItemViewPrivate::BufferBefore | QQuickItemViewPrivate::BufferAfter;
     d->refillOrLayout();
+    if (d->reuseItems && d->model)
+        d->model->drainReusableItemsPool(0);
     if (d->haveHighlightRange && d->highlightRange == QQuickItemView::StrictlyEnforceRange)
         d->updateHighlight();
 }
@@ -1573,7 +1595,7 @@ QQuickItemViewPrivate::QQuickItemViewPrivate()
     , inLayout(false), inViewportMoved(false), forceLayout(false), currentIndexCleared(false)
     , haveHighlightRange(false), autoHighlight(true), highlightRangeStartValid(false), highlightRangeEndValid(false)
     , fillCacheBuffer(false), inRequest(false)
-    , runDelayedRemoveTransition(false), delegateValidated(false)
+    , runDelayedRemoveTransition(false), delegateValidated(false), reuseItems(false)
 {
     bufferPause.addAnimationChangeListener(this, QAbstractAnimationJob::Completion);
     bufferPause.setLoopCount(1);
@@ -1772,6 +1794,11 @@ void QQuickItemViewPrivate::clear()
     createHighlight();
     trackedItem = nullptr;
 
+    // Nothing is left to reuse the pooled delegates for.
+    if (model)
+        model->drainReusableItemsPool(0);
+    pooledItems.clear();
+
     if (requestedIndex >= 0) {
         if (model)
             model->cancel(requestedIndex);
@@ -2003,6 +2030,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
     }
 
     updateUnrequestedIndexes();
+    aboutToApplyModelChanges(currentChanges.pendingChanges);
 
     FxViewItem *prevVisibleItemsFirst = visibleItems.count() ? *visibleItems.constBegin() : 0;
     int prevItemCount = itemCount;
@@ -2382,6 +2410,7 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
         item->setParentItem(q->contentItem());
         if (requestedIndex == modelIndex)
             requestedIndex = -1;
+        const bool reused = pooledItems.remove(item);
         FxViewItem *viewItem = newViewItem(modelIndex, item);
         if (viewItem) {
             viewItem->index = modelIndex;
@@ -2389,6 +2418,8 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
             // until after bindings are evaluated
             initializeViewItem(viewItem);
             unrequestedItems.remove(item);
+            if (reused && viewItem->attached)
+                viewItem->attached->emitReused();
         }
         inRequest = false;
         return viewItem;
@@ -2432,6 +2463,7 @@ void QQuickItemView::destroyingItem(QObject *object)
     if (item) {
         item->setParentItem(nullptr);
         d->unrequestedItems.remove(item);
+        d->pooledItems.remove(item);
     }
 }
 
@@ -2444,7 +2476,8 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
         trackedItem = nullptr;
     item->trackGeometry(false);
 
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item,
+            reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
     if (item->item) {
         if (flags == 0) {
             // item was not destroyed, and we no longer reference it.
@@ -2452,6 +2485,12 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
             unrequestedItems.insert(item->item, model->indexOf(item->item, q));
         } else if (flags & QQmlInstanceModel::Destroyed) {
             item->item->setParentItem(nullptr);
+        } else if (flags & QQmlInstanceModel::Pooled) {
+            // item is kept alive by the model until it is reused for another index.
+            QQuickItemPrivate::get(item->item)->setCulled(true);
+            pooledItems.insert(item->item);
+            if (item->attached)
+                item->attached->emitPooled();
         }
     }
     delete item;
@@ -296,6 +296,7 @@ public:
     FxViewItem *currentItem;
     FxViewItem *trackedItem;
     QHash<QQuickItem*,int> unrequestedItems;
+    QSet<QQuickItem *> pooledItems;
     int requestedIndex;
     QQuickItemViewChangeSet currentChanges;
     QQuickItemViewChangeSet bufferedChanges;
@@ -341,6 +342,11 @@ public:
     bool inRequest : 1;
     bool runDelayedRemoveTransition : 1;
     bool delegateValidated : 1;
+    bool reuseItems : 1;
+
+    // Number of frames a released delegate stays in the reuse pool while the view
+    // is moving. Whatever is left when the movement ends is destroyed.
+    static const int MaxReusePoolFrames = 2;
 
 protected:
     virtual Qt::Orientation layoutOrientation() const = 0;
@@ -381,6 +387,7 @@ protected:
     virtual void layoutVisibleItems(int fromModelIndex = 0) = 0;
     virtual void changedVisibleIndex(int newIndex) = 0;
 
+    virtual void aboutToApplyModelChanges(const QQmlChangeSet &) {}
     virtual bool applyInsertionChange(const QQmlChangeSet::Change &insert, ChangeResult *changeResult,
                 QList<FxViewItem *> *newItems, QList<MovedItem> *movingIntoView) = 0;
 
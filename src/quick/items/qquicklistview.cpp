@@ -59,6 +59,183 @@ QT_BEGIN_NAMESPACE
 
 class FxListItemSG;
 
+// Remembers the size of every delegate that has been laid out, so that the
+// position of any model index can be found in O(log n) without creating the
+// delegates in between.  Indexes that have never been measured are estimated.
+//
+// The sizes are kept in a Fenwick tree alongside the number of measured
+// indexes in each range, which lets the estimate change without rebuilding it.
+class QQuickListViewSizeCache
+{
+public:
+    QQuickListViewSizeCache() : m_dirty(false) {}
+
+    int count() const { return m_sizes.count(); }
+    int measuredCount() const;
+    qreal measuredAverage() const;
+
+    void clear();
+    void insert(int index, int count);
+    void remove(int index, int count);
+    void setSize(int index, qreal size);
+
+    qreal offsetOf(int index, qreal estimate, qreal spacing) const;
+    int indexAt(qreal offset, qreal estimate, qreal spacing) const;
+
+private:
+    void prefix(int index, qreal *size, int *count) const;
+    void update(int index, qreal sizeDelta, int countDelta);
+    void rebuild() const;
+
+    QVector<qreal> m_sizes; // < 0 for indexes that have not been measured
+    mutable QVector<qreal> m_sizeTree;
+    mutable QVector<int> m_countTree;
+    mutable bool m_dirty;
+};
+
+int QQuickListViewSizeCache::measuredCount() const
+{
+    qreal size;
+    int count;
+    prefix(m_sizes.count(), &size, &count);
+    return count;
+}
+
+qreal QQuickListViewSizeCache::measuredAverage() const
+{
+    qreal size;
+    int count;
+    prefix(m_sizes.count(), &size, &count);
+    return count ? size / count : 0.0;
+}
+
+void QQuickListViewSizeCache::clear()
+{
+    m_sizes.clear();
+    m_sizeTree.clear();
+    m_countTree.clear();
+    m_dirty = false;
+}
+
+void QQuickListViewSizeCache::insert(int index, int count)
+{
+    if (index < 0 || count <= 0)
+        return;
+    if (index > m_sizes.count())
+        count += index - m_sizes.count();
+    m_sizes.insert(qMin(index, m_sizes.count()), count, -1.0);
+    m_dirty = true;
+}
+
+void QQuickListViewSizeCache::remove(int index, int count)
+{
+    if (index < 0 || index >= m_sizes.count() || count <= 0)
+        return;
+    m_sizes.remove(index, qMin(count, m_sizes.count() - index));
+    m_dirty = true;
+}
+
+void QQuickListViewSizeCache::setSize(int index, qreal size)
+{
+    if (index < 0 || size < 0)
+        return;
+    if (index >= m_sizes.count()) {
+        // Indexes past the end are only ever estimated, so the cache grows lazily.
+        m_sizes.insert(m_sizes.count(), index + 1 - m_sizes.count(), -1.0);
+        m_dirty = true;
+    }
+    qreal &oldSize = m_sizes[index];
+    if (oldSize == size)
+        return;
+    if (!m_dirty)
+        update(index, size - qMax<qreal>(oldSize, 0), oldSize < 0 ? 1 : 0);
+    oldSize = size;
+}
+
+// Returns the distance from the start of the first item to the start of the item at \a index.
+qreal QQuickListViewSizeCache::offsetOf(int index, qreal estimate, qreal spacing) const
+{
+    if (index <= 0)
+        return 0;
+    qreal size;
+    int count;
+    prefix(qMin(index, m_sizes.count()), &size, &count);
+    return size + (index - count) * estimate + index * spacing;
+}
+
+// Returns the index of the item that contains \a offset, which may be past the end of the cache.
+int QQuickListViewSizeCache::indexAt(qreal offset, qreal estimate, qreal spacing) const
+{
+    if (offset <= 0)
+        return 0;
+    if (m_dirty)
+        rebuild();
+
+    const int n = m_sizes.count();
+    int bit = 1;
+    while (bit * 2 <= n)
+        bit *= 2;
+
+    int index = 0;
+    qreal pos = 0;
+    for (; n && bit; bit /= 2) {
+        const int next = index + bit;
+        if (next > n)
+            continue;
+        const qreal span = m_sizeTree.at(next) + (bit - m_countTree.at(next)) * estimate + bit * spacing;
+        if (pos + span <= offset) {
+            index = next;
+            pos += span;
+        }
+    }
+    if (index == n && estimate + spacing > 0)
+        index += int((offset - pos) / (estimate + spacing));
+    return index;
+}
+
+void QQuickListViewSizeCache::prefix(int index, qreal *size, int *count) const
+{
+    if (m_dirty)
+        rebuild();
+    *size = 0;
+    *count = 0;
+    for (int i = index; i > 0; i -= i & -i) {
+        *size += m_sizeTree.at(i);
+        *count += m_countTree.at(i);
+    }
+}
+
+void QQuickListViewSizeCache::update(int index, qreal sizeDelta, int countDelta)
+{
+    const int n = m_sizes.count();
+    for (int i = index + 1; i <= n; i += i & -i) {
+        m_sizeTree[i] += sizeDelta;
+        m_countTree[i] += countDelta;
+    }
+}
+
+void QQuickListViewSizeCache::rebuild() const
+{
+    const int n = m_sizes.count();
+    m_sizeTree.fill(0, n + 1);
+    m_countTree.fill(0, n + 1);
+    for (int i = 1; i <= n; ++i) {
+        const qreal size = m_sizes.at(i - 1);
+        if (size >= 0) {
+            m_sizeTree[i] += size;
+            m_countTree[i] += 1;
+        }
+        const int parent = i + (i & -i);
+        if (parent <= n) {
+            m_sizeTree[parent] += m_sizeTree.at(i);
+            m_countTree[parent] += m_countTree.at(i);
+        }
+    }
+    m_dirty = false;
+}
+
+//----------------------------------------------------------------------------
+
 class QQuickListViewPrivate : public QQuickItemViewPrivate
 {
     Q_DECLARE_PUBLIC(QQuickListView)
@@ -131,6 +308,9 @@ public:
     void initializeCurrentItem() override;
 
     void updateAverage();
+    void cacheItemSize(FxViewItem *item);
+
+    void aboutToApplyModelChanges(const QQmlChangeSet &changes) override;
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override;
     void fixupPosition() override;
@@ -165,9 +345,12 @@ public:
     QString lastVisibleSection;
     QString nextSection;
 
+    QQuickListViewSizeCache sizeCache;
+
     qreal overshootDist;
     bool correctFlick : 1;
     bool inFlickCorrection : 1;
+    bool cacheItemSizes : 1;
 
     QQuickListViewPrivate()
         : orient(QQuickListView::Vertical)
@@ -179,7 +362,7 @@ public:
         , highlightPosAnimator(nullptr), highlightWidthAnimator(nullptr), highlightHeightAnimator(nullptr)
         , highlightMoveVelocity(400), highlightResizeVelocity(400), highlightResizeDuration(-1)
         , sectionCriteria(nullptr), currentSectionItem(nullptr), nextSectionItem(nullptr)
-        , overshootDist(0.0), correctFlick(false), inFlickCorrection(false)
+        , overshootDist(0.0), correctFlick(false), inFlickCorrection(false), cacheItemSizes(false)
     {
         highlightMoveDuration = -1; //override default value set in base class
     }
@@ -426,7 +609,9 @@ qreal QQuickListViewPrivate::originPosition() const
     qreal pos = 0;
     if (!visibleItems.isEmpty()) {
         pos = (*visibleItems.constBegin())->position();
-        if (visibleIndex > 0)
+        if (cacheItemSizes)
+            pos -= sizeCache.offsetOf(visibleIndex, averageSize, spacing);
+        else if (visibleIndex > 0)
             pos -= visibleIndex * (averageSize + spacing);
     }
     return pos;
@@ -453,10 +638,20 @@ qreal QQuickListViewPrivate::lastPosition() const
             invisibleCount = model->count();
         }
         pos = (*(--visibleItems.constEnd()))->endPosition();
-        if (invisibleCount > 0)
-            pos += invisibleCount * (averageSize + spacing);
+        if (invisibleCount > 0) {
+            if (cacheItemSizes) {
+                const int count = model->count();
+                pos += sizeCache.offsetOf(count, averageSize, spacing)
+                        - sizeCache.offsetOf(count - invisibleCount, averageSize, spacing);
+            } else {
+                pos += invisibleCount * (averageSize + spacing);
+            }
+        }
     } else if (model && model->count()) {
-        pos = (model->count() * averageSize + (model->count()-1) * spacing);
+        if (cacheItemSizes)
+            pos = sizeCache.offsetOf(model->count(), averageSize, spacing) - spacing;
+        else
+            pos = (model->count() * averageSize + (model->count()-1) * spacing);
     }
     return pos;
 }
@@ -467,6 +662,18 @@ qreal QQuickListViewPrivate::positionAt(int modelIndex) const
         return item->position();
     }
     if (!visibleItems.isEmpty()) {
+        if (cacheItemSizes) {
+            if (modelIndex < visibleIndex) {
+                return (*visibleItems.constBegin())->position()
+                        - sizeCache.offsetOf(visibleIndex, averageSize, spacing)
+                        + sizeCache.offsetOf(modelIndex, averageSize, spacing);
+            } else {
+                int lastIndex = findLastVisibleIndex(visibleIndex);
+                return (*(--visibleItems.constEnd()))->endPosition() + spacing
+                        - sizeCache.offsetOf(lastIndex + 1, averageSize, spacing)
+                        + sizeCache.offsetOf(modelIndex, averageSize, spacing);
+            }
+        }
         if (modelIndex < visibleIndex) {
             int count = visibleIndex - modelIndex;
             qreal cs = 0;
@@ -488,6 +695,18 @@ qreal QQuickListViewPrivate::endPositionAt(int modelIndex) const
     if (FxViewItem *item = visibleItem(modelIndex))
         return item->endPosition();
     if (!visibleItems.isEmpty()) {
+        if (cacheItemSizes) {
+            if (modelIndex < visibleIndex) {
+                return (*visibleItems.constBegin())->position() - spacing
+                        - sizeCache.offsetOf(visibleIndex, averageSize, spacing)
+                        + sizeCache.offsetOf(modelIndex + 1, averageSize, spacing);
+            } else {
+                int lastIndex = findLastVisibleIndex(visibleIndex);
+                return (*(--visibleItems.constEnd()))->endPosition()
+                        - sizeCache.offsetOf(lastIndex + 1, averageSize, spacing)
+                        + sizeCache.offsetOf(modelIndex + 1, averageSize, spacing);
+            }
+        }
         if (modelIndex < visibleIndex) {
             int count = visibleIndex - modelIndex;
             return (*visibleItems.constBegin())->position() - (count - 1) * (averageSize + spacing) - spacing;
@@ -574,6 +793,7 @@ void QQuickListViewPrivate::clear()
     releaseSectionItem(nextSectionItem);
     nextSectionItem = nullptr;
     lastVisibleSection = QString();
+    sizeCache.clear();
     QQuickItemViewPrivate::clear();
 }
 
@@ -663,13 +883,17 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         // We've jumped more than a page.  Estimate which items are now
         // visible and fill from there.
         int count = (fillFrom - itemEnd) / (averageSize + spacing);
-        int newModelIdx = qBound(0, modelIndex + count, model->count());
+        int newModelIdx = modelIndex + count;
+        if (cacheItemSizes)
+            newModelIdx = sizeCache.indexAt(fillFrom - originPosition(), averageSize, spacing);
+        newModelIdx = qBound(0, newModelIdx, model->count());
         count = newModelIdx - modelIndex;
         if (count) {
+            const qreal newPos = cacheItemSizes ? positionAt(newModelIdx) : itemEnd + count * (averageSize + spacing);
             releaseVisibleItems();
             modelIndex = newModelIdx;
             visibleIndex = modelIndex;
-            visiblePos = itemEnd + count * (averageSize + spacing);
+            visiblePos = newPos;
             itemEnd = visiblePos;
         }
     }
@@ -687,6 +911,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
             item->setPosition(pos, true);
         if (item->item)
             QQuickItemPrivate::get(item->item)->setCulled(doBuffer);
+        cacheItemSize(item);
         pos += item->size() + spacing;
         visibleItems.append(item);
         ++modelIndex;
@@ -706,6 +931,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
             item->setPosition(visiblePos, true);
         if (item->item)
             QQuickItemPrivate::get(item->item)->setCulled(doBuffer);
+        cacheItemSize(item);
         visibleItems.prepend(item);
         changed = true;
     }
@@ -795,6 +1021,7 @@ void QQuickListViewPrivate::layoutVisibleItems(int fromModelIndex)
         qreal sum = firstItem->size();
         qreal pos = firstItem->position() + firstItem->size() + spacing;
         firstItem->setVisible(firstItem->endPosition() >= from && firstItem->position() <= to);
+        cacheItemSize(firstItem);
 
         for (int i=1; i < visibleItems.count(); ++i) {
             FxListItemSG *item = static_cast<FxListItemSG*>(visibleItems.at(i));
@@ -804,9 +1031,13 @@ void QQuickListViewPrivate::layoutVisibleItems(int fromModelIndex)
             }
             pos += item->size() + spacing;
             sum += item->size();
+            cacheItemSize(item);
             fixedCurrent = fixedCurrent || (currentItem && item->item == currentItem->item);
         }
-        averageSize = qRound(sum / visibleItems.count());
+        if (cacheItemSizes && sizeCache.measuredCount())
+            averageSize = qRound(sizeCache.measuredAverage());
+        else
+            averageSize = qRound(sum / visibleItems.count());
 
         // move current item if it is not a visible item.
         if (currentIndex >= 0 && currentItem && !fixedCurrent)
@@ -1312,7 +1543,27 @@ void QQuickListViewPrivate::updateAverage()
     qreal sum = 0.0;
     for (FxViewItem *item : qAsConst(visibleItems))
         sum += item->size();
-    averageSize = qRound(sum / visibleItems.count());
+    if (cacheItemSizes && sizeCache.measuredCount())
+        averageSize = qRound(sizeCache.measuredAverage());
+    else
+        averageSize = qRound(sum / visibleItems.count());
+}
+
+void QQuickListViewPrivate::cacheItemSize(FxViewItem *item)
+{
+    if (cacheItemSizes && item->index >= 0)
+        sizeCache.setSize(item->index, item->size());
+}
+
+void QQuickListViewPrivate::aboutToApplyModelChanges(const QQmlChangeSet &changes)
+{
+    if (!cacheItemSizes)
+        return;
+    // Moved items lose their measured size; they are measured again when laid out.
+    for (const QQmlChangeSet::Change &removal : changes.removes())
+        sizeCache.remove(removal.index, removal.count);
+    for (const QQmlChangeSet::Change &insertion : changes.inserts())
+        sizeCache.insert(insertion.index, insertion.count);
 }
 
 qreal QQuickListViewPrivate::headerSize() const
@@ -1976,6 +2227,34 @@ QQuickListView::~QQuickListView()
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlattachedsignal QtQuick::ListView::pooled()
+    \since 5.11
+
+    This attached signal is emitted after an item has been released from the
+    view and parked in the reuse pool, when \l reuseItems is \c true. The item
+    is hidden, but keeps its state; handlers can use it to stop timers or
+    animations that should not run while the item is not in use.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reused(), reuseItems
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::ListView::reused()
+    \since 5.11
+
+    This attached signal is emitted after a pooled item has been taken out of
+    the reuse pool and bound to a new model index. Bindings on \c index and the
+    model roles have already been updated when the signal is emitted, but any
+    other state the delegate holds has to be reset by the handler.
+
+    The corresponding handler is \c onReused.
+
+    \sa pooled(), reuseItems
+*/
+
 /*!
     \qmlproperty model QtQuick::ListView::model
     This property holds the model providing data for the list.
@@ -2313,6 +2592,30 @@ void QQuickListView::setOrientation(QQuickListView::Orientation orientation)
     displayMarginBeginning or displayMarginEnd.
 */
 
+/*!
+    \qmlproperty bool QtQuick::ListView::reuseItems
+    \since 5.11
+
+    This property holds whether delegate items that move out of the view are
+    reused for items that move into it.
+
+    When \c true, a delegate item that is released is not destroyed but kept
+    in a pool, and handed out again the next time the view needs an item for
+    any index, instead of incubating a new one. This avoids the cost of
+    creating and destroying delegates while the list is flicked. Items that have
+    not been reused by the time the view stops moving are destroyed.
+
+    A reused item keeps all its state apart from \c index and the model roles,
+    which are rebound to the new index. Delegates that hold other state must
+    reset it in the \l reused() attached signal handler. Items are only reused
+    with QAbstractItemModel based models, such as ListModel, and with integer
+    or array models.
+
+    The default value is \c false.
+
+    \sa pooled(), reused()
+*/
+
 /*!
     \qmlproperty int QtQuick::ListView::displayMarginBeginning
     \qmlproperty int QtQuick::ListView::displayMarginEnd
@@ -2678,6 +2981,51 @@ void QQuickListView::setFooterPositioning(QQuickListView::FooterPositioning posi
     }
 }
 
+/*!
+    \qmlproperty bool QtQuick::ListView::cacheItemSizes
+    \since 5.11
+
+    This property holds whether the view remembers the size of each delegate
+    it has created.
+
+    By default, ListView estimates the position of items that have not been
+    created from the average size of the currently visible items. If the
+    delegates have varying sizes, the estimated content size changes as the
+    view is scrolled, and positioning the view at a distant index may place
+    it away from the requested item.
+
+    When this property is \c true, the size of every delegate is recorded as
+    it is laid out, and only the items that have never been created are
+    estimated, using the average of the recorded sizes. The position of any
+    index is then found without creating the delegates in between, which
+    keeps the content size stable and makes \l positionViewAtIndex() accurate
+    for items that have been seen before.
+
+    The recorded sizes are discarded when the model is reset, or when the
+    model or delegate is changed.
+
+    The default value is \c false.
+*/
+bool QQuickListView::cacheItemSizes() const
+{
+    Q_D(const QQuickListView);
+    return d->cacheItemSizes;
+}
+
+void QQuickListView::setCacheItemSizes(bool cache)
+{
+    Q_D(QQuickListView);
+    if (d->cacheItemSizes == cache)
+        return;
+
+    d->applyPendingChanges();
+    d->cacheItemSizes = cache;
+    d->sizeCache.clear();
+    if (isComponentComplete())
+        d->forceLayoutPolish();
+    emit cacheItemSizesChanged();
+}
+
 /*!
     \qmlproperty Transition QtQuick::ListView::populate
 
@@ -2989,6 +3337,8 @@ void QQuickListView::viewportMoved(Qt::Orientations orient)
     }
 
     d->refillOrLayout();
+    if (d->reuseItems)
+        d->model->drainReusableItemsPool(QQuickItemViewPrivate::MaxReusePoolFrames);
 
     // Set visibility of items to eliminate cost of items outside the visible area.
     qreal from = d->isContentFlowReversed() ? -d->position()-d->displayMarginBeginning-d->size() : d->position()-d->displayMarginBeginning;
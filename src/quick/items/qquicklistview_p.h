@@ -129,6 +129,8 @@ class Q_QUICK_PRIVATE_EXPORT QQuickListView : public QQuickItemView
     Q_PROPERTY(HeaderPositioning headerPositioning READ headerPositioning WRITE setHeaderPositioning NOTIFY headerPositioningChanged REVISION 2)
     Q_PROPERTY(FooterPositioning footerPositioning READ footerPositioning WRITE setFooterPositioning NOTIFY footerPositioningChanged REVISION 2)
 
+    Q_PROPERTY(bool cacheItemSizes READ cacheItemSizes WRITE setCacheItemSizes NOTIFY cacheItemSizesChanged REVISION 11)
+
     Q_CLASSINFO("DefaultProperty", "data")
 
 public:
@@ -174,6 +176,9 @@ public:
     FooterPositioning footerPositioning() const;
     void setFooterPositioning(FooterPositioning positioning);
 
+    bool cacheItemSizes() const;
+    void setCacheItemSizes(bool cache);
+
     static QQuickListViewAttached *qmlAttachedProperties(QObject *);
 
 public Q_SLOTS:
@@ -190,6 +195,7 @@ Q_SIGNALS:
     void snapModeChanged();
     Q_REVISION(2) void headerPositioningChanged();
     Q_REVISION(2) void footerPositioningChanged();
+    Q_REVISION(11) void cacheItemSizesChanged();
 
 protected:
     void viewportMoved(Qt::Orientations orient) override;
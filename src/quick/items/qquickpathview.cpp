@@ -95,7 +95,7 @@ QQuickPathViewPrivate::QQuickPathViewPrivate()
     , stealMouse(false), ownModel(false), interactive(true), haveHighlightRange(true)
     , autoHighlight(true), highlightUp(false), layoutScheduled(false)
     , moving(false), flicking(false), dragging(false), inRequest(false), delegateValidated(false)
-    , inRefill(false)
+    , inRefill(false), reuseItems(false)
     , dragMargin(0), deceleration(100), maximumFlickVelocity(QML_FLICK_DEFAULTMAXVELOCITY)
     , moveOffset(this, &QQuickPathViewPrivate::setAdjustedOffset), flickDuration(0)
     , pathItems(-1), requestedIndex(-1), cacheSize(0), requestedZ(0)
@@ -195,6 +195,23 @@ void QQuickPathView::initItem(int index, QObject *object)
     }
 }
 
+/*
+  A pooled item handed out again by the model doesn't go through createdItem()
+  and initItem(). It is already parented to the view and attached; updateItem()
+  positions it once refill() adds it to the path.
+*/
+void QQuickPathView::reusedItem(int index, QObject *object)
+{
+    Q_D(QQuickPathView);
+    Q_UNUSED(index);
+    QQuickItem *item = qmlobject_cast<QQuickItem*>(object);
+    if (!item)
+        return;
+    item->setZ(d->requestedZ);
+    if (QQuickPathViewAttached *att = d->attached(item))
+        emit att->reused();
+}
+
 void QQuickPathViewPrivate::releaseItem(QQuickItem *item)
 {
     if (!item || !model)
@@ -202,7 +219,8 @@ void QQuickPathViewPrivate::releaseItem(QQuickItem *item)
     qCDebug(lcItemViewDelegateLifecycle) << "release" << item;
     QQuickItemPrivate *itemPrivate = QQuickItemPrivate::get(item);
     itemPrivate->removeItemChangeListener(this, QQuickItemPrivate::Geometry);
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item,
+            reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
     if (!flags) {
         // item was not destroyed, and we no longer reference it.
         if (QQuickPathViewAttached *att = attached(item))
@@ -210,6 +228,15 @@ void QQuickPathViewPrivate::releaseItem(QQuickItem *item)
     } else if (flags & QQmlInstanceModel::Destroyed) {
         // but we still reference it
         item->setParentItem(nullptr);
+    } else if (flags & QQmlInstanceModel::Pooled) {
+        // item is kept alive by the model until it is reused for another index.
+        QQuickItemPrivate::get(item)->setCulled(true);
+        if (QQuickPathViewAttached *att = attached(item)) {
+            att->m_percent = -1;
+            att->setOnPath(false);
+            att->setIsCurrentItem(false);
+            emit att->pooled();
+        }
     }
 }
 
@@ -595,6 +622,34 @@ QQuickPathView::~QQuickPathView()
     \snippet qml/pathview/pathview.qml 1
 */
 
+/*!
+    \qmlattachedsignal QtQuick::PathView::pooled()
+    \since 5.11
+
+    This attached signal is emitted after an item has been released from the
+    view and parked in the reuse pool, when \l reuseItems is \c true. The item
+    is hidden, but keeps its state; handlers can use it to stop timers or
+    animations that should not run while the item is not in use.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reused(), reuseItems
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::PathView::reused()
+    \since 5.11
+
+    This attached signal is emitted after a pooled item has been taken out of
+    the reuse pool and bound to a new model index. Bindings on \c index and the
+    model roles have already been updated when the signal is emitted, but any
+    other state the delegate holds has to be reset by the handler.
+
+    The corresponding handler is \c onReused.
+
+    \sa pooled(), reuseItems
+*/
+
 /*!
     \qmlproperty model QtQuick::PathView::model
     This property holds the model providing data for the view.
@@ -630,7 +685,11 @@ void QQuickPathView::setModel(const QVariant &m)
                              this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                              this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                             this, QQuickPathView, SLOT(reusedItem(int,QObject*)));
         d->clear();
+        if (d->reuseItems)
+            d->model->drainReusableItemsPool(0);
     }
 
     d->modelVariant = model;
@@ -661,6 +720,8 @@ void QQuickPathView::setModel(const QVariant &m)
                           this, QQuickPathView, SLOT(createdItem(int,QObject*)));
         qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                           this, QQuickPathView, SLOT(initItem(int,QObject*)));
+        qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                          this, QQuickPathView, SLOT(reusedItem(int,QObject*)));
         d->modelCount = d->model->count();
     }
     if (isComponentComplete()) {
@@ -1347,6 +1408,46 @@ void QQuickPathView::setCacheItemCount(int i)
     emit cacheItemCountChanged();
 }
 
+/*!
+    \qmlproperty bool QtQuick::PathView::reuseItems
+    \since 5.11
+
+    This property holds whether delegate items that move off the path are
+    reused for items that move onto it.
+
+    When \c true, a delegate item that is released is not destroyed but kept
+    in a pool, and handed out again the next time the view needs an item for
+    any index, instead of incubating a new one. Items that have not been
+    reused by the time the view stops moving are destroyed.
+
+    A reused item keeps all its state apart from \c index and the model roles,
+    which are rebound to the new index. Delegates that hold other state must
+    reset it in the \l reused() attached signal handler. Items are only reused
+    with QAbstractItemModel based models, such as ListModel, and with integer
+    or array models.
+
+    The default value is \c false.
+
+    \sa pooled(), reused()
+*/
+bool QQuickPathView::reuseItems() const
+{
+    Q_D(const QQuickPathView);
+    return d->reuseItems;
+}
+
+void QQuickPathView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickPathView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model)
+        d->model->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
 /*!
     \qmlproperty enumeration QtQuick::PathView::snapMode
 
@@ -2167,6 +2268,9 @@ void QQuickPathView::refill()
         d->releaseItem(item);
     d->itemCache.clear();
 
+    if (d->reuseItems)
+        d->model->drainReusableItemsPool(QQuickPathViewPrivate::MaxReusePoolFrames);
+
     d->inRefill = false;
     if (currentChanged)
         emit currentItemChanged();
@@ -2294,6 +2398,8 @@ void QQuickPathView::movementEnding()
         d->moving = false;
         emit movingChanged();
         emit movementEnded();
+        if (d->reuseItems && d->model)
+            d->model->drainReusableItemsPool(0);
     }
     d->moveDirection = d->movementDirection;
 }
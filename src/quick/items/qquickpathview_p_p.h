@@ -156,6 +156,7 @@ public:
     bool inRequest : 1;
     bool delegateValidated : 1;
     bool inRefill : 1;
+    bool reuseItems : 1;
     QElapsedTimer timer;
     qint64 lastPosTime;
     QPointF lastPos;
@@ -188,6 +189,10 @@ public:
     int modelCount;
     QPODVector<qreal,10> velocityBuffer;
     QQuickPathView::SnapMode snapMode;
+
+    // Number of frames a released delegate stays in the reuse pool while the view
+    // is moving. Whatever is left when the movement ends is destroyed.
+    static const int MaxReusePoolFrames = 2;
 };
 
 QT_END_NAMESPACE
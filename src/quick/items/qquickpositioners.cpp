@@ -66,6 +66,54 @@ void QQuickBasePositionerPrivate::unwatchChanges(QQuickItem* other)
     otherPrivate->removeItemChangeListener(this, watchedChanges);
 }
 
+void QQuickBasePositionerPrivate::itemSizeChanged(QQuickItem *item, const QRectF &oldGeometry)
+{
+    Q_Q(QQuickBasePositioner);
+    // Items with no width or height are not positioned, so becoming empty or
+    // non-empty changes which items are laid out.
+    if (!item->width() || !item->height() || !oldGeometry.width() || !oldGeometry.height()) {
+        setPositioningDirty();
+        return;
+    }
+
+    const int index = q->positionedItems.find(QQuickBasePositioner::PositionedItem(item));
+    if (index < 0)
+        return; // hidden items don't affect the layout
+
+    if (!positioningDirty) {
+        relayoutOnly = true;
+        firstDirtyIndex = index;
+        positioningDirty = true;
+        q->polish();
+    } else if (relayoutOnly) {
+        firstDirtyIndex = qMin(firstDirtyIndex, index);
+    }
+}
+
+/*
+  Repositions the items after a change to their sizes only. The set of positioned
+  items, their order and their anchors are the same as in the last full layout,
+  so those don't need to be collected and checked again.
+  */
+void QQuickBasePositionerPrivate::relayout()
+{
+    Q_Q(QQuickBasePositioner);
+    positioningDirty = false;
+    relayoutOnly = false;
+    doingPositioning = true;
+
+    QSizeF contentSize(0,0);
+    q->doPositioning(&contentSize);
+    // A child resized during the pass has already marked the positioner
+    // dirty again; keep its index for the relayout that follows.
+    if (!positioningDirty)
+        firstDirtyIndex = 0;
+
+    doingPositioning = false;
+    q->setImplicitSize(contentSize.width(), contentSize.height());
+    emit q->positioningComplete();
+}
+
 
 QQuickBasePositioner::PositionedItem::PositionedItem(QQuickItem *i)
     : item(i)
@@ -180,7 +228,11 @@ QQuickBasePositioner::~QQuickBasePositioner()
 void QQuickBasePositioner::updatePolish()
 {
     Q_D(QQuickBasePositioner);
-    if (d->positioningDirty)
+    if (!d->positioningDirty)
+        return;
+    if (d->relayoutOnly && !d->transitioner && !d->anchorConflict && !d->doingPositioning)
+        d->relayout();
+    else
         prePositioning();
 }
 
@@ -302,6 +354,8 @@ void QQuickBasePositioner::prePositioning()
         return;
 
     d->positioningDirty = false;
+    d->relayoutOnly = false;
+    d->firstDirtyIndex = 0;
     d->doingPositioning = true;
     //Need to order children by creation order modified by stacking order
     QList<QQuickItem *> children = childItems();
@@ -312,6 +366,7 @@ void QQuickBasePositioner::prePositioning()
         oldItems.append(unpositionedItems[ii]);
     unpositionedItems.clear();
     int addedIndex = -1;
+    int nextOldIndex = 0;
 
     for (int ii = 0; ii < children.count(); ++ii) {
         QQuickItem *child = children.at(ii);
@@ -319,7 +374,12 @@ void QQuickBasePositioner::prePositioning()
             continue;
         QQuickItemPrivate *childPrivate = QQuickItemPrivate::get(child);
         PositionedItem posItem(child);
-        int wIdx = oldItems.find(posItem);
+        // The children are usually in the same order as last time, so check the
+        // item after the previous match before searching all of them.
+        int wIdx = nextOldIndex < oldItems.count() && oldItems.at(nextOldIndex).item == child
+                ? nextOldIndex : oldItems.find(posItem);
+        if (wIdx >= 0)
+            nextOldIndex = wIdx + 1;
         if (wIdx < 0) {
             d->watchChanges(child);
             posItem.isNew = true;
@@ -944,14 +1004,21 @@ QQuickColumn::QQuickColumn(QQuickItem *parent)
 void QQuickColumn::doPositioning(QSizeF *contentSize)
 {
     //Precondition: All items in the positioned list have a valid item pointer and should be positioned
+    QQuickBasePositionerPrivate *d = static_cast<QQuickBasePositionerPrivate* >(QQuickBasePositionerPrivate::get(this));
     qreal voffset = topPadding();
     const qreal padding = leftPadding() + rightPadding();
     contentSize->setWidth(qMax(contentSize->width(), padding));
 
+    // Take a copy: a child resized while it is positioned records a new first
+    // dirty index for the follow-up pass, which must not affect this one.
+    const int firstDirtyIndex = d->firstDirtyIndex;
+
     for (int ii = 0; ii < positionedItems.count(); ++ii) {
         PositionedItem &child = positionedItems[ii];
-        positionItem(child.itemX() + leftPadding() - child.leftPadding, voffset, &child);
-        child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+        if (ii >= firstDirtyIndex) {
+            positionItem(child.itemX() + leftPadding() - child.leftPadding, voffset, &child);
+            child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+        }
         contentSize->setWidth(qMax(contentSize->width(), child.item->width() + padding));
 
         voffset += child.item->height();
@@ -1211,13 +1278,19 @@ void QQuickRow::doPositioning(QSizeF *contentSize)
     const qreal padding = topPadding() + bottomPadding();
     contentSize->setHeight(qMax(contentSize->height(), padding));
 
+    // Take a copy: a child resized while it is positioned records a new first
+    // dirty index for the follow-up pass, which must not affect this one.
+    const int firstDirtyIndex = d->firstDirtyIndex;
+
     QList<qreal> hoffsets;
     for (int ii = 0; ii < positionedItems.count(); ++ii) {
         PositionedItem &child = positionedItems[ii];
 
         if (d->isLeftToRight()) {
-            positionItem(hoffset, child.itemY() + topPadding() - child.topPadding, &child);
-            child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+            if (ii >= firstDirtyIndex) {
+                positionItem(hoffset, child.itemY() + topPadding() - child.topPadding, &child);
+                child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+            }
         } else {
             hoffsets << hoffset;
         }
@@ -2125,6 +2198,9 @@ void QQuickFlow::doPositioning(QSizeF *contentSize)
 {
     //Precondition: All items in the positioned list have a valid item pointer and should be positioned
     Q_D(QQuickFlow);
+    // Take a copy: a child resized while it is positioned records a new first
+    // dirty index for the follow-up pass, which must not affect this one.
+    const int firstDirtyIndex = d->firstDirtyIndex;
 
     qreal hoffset1 = leftPadding();
     qreal hoffset2 = rightPadding();
@@ -2156,13 +2232,17 @@ void QQuickFlow::doPositioning(QSizeF *contentSize)
         }
 
         if (d->isLeftToRight()) {
-            positionItem(hoffset, voffset, &child);
-            child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+            if (i >= firstDirtyIndex) {
+                positionItem(hoffset, voffset, &child);
+                child.updatePadding(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+            }
         } else {
             hoffsets << hoffset;
-            positionItemY(voffset, &child);
-            child.topPadding = topPadding();
-            child.bottomPadding = bottomPadding();
+            if (i >= firstDirtyIndex) {
+                positionItemY(voffset, &child);
+                child.topPadding = topPadding();
+                child.bottomPadding = bottomPadding();
+            }
         }
 
         contentSize->setWidth(qMax(contentSize->width(), hoffset + child.item->width() + hoffset2));
@@ -90,7 +90,7 @@ public:
 
     QQuickBasePositionerPrivate()
         : spacing(0), type(QQuickBasePositioner::None)
-        , transitioner(0), positioningDirty(false)
+        , transitioner(0), firstDirtyIndex(0), positioningDirty(false), relayoutOnly(false)
         , doingPositioning(false), anchorConflict(false), layoutDirection(Qt::LeftToRight)
 
     {
@@ -110,13 +110,21 @@ public:
     void unwatchChanges(QQuickItem* other);
     void setPositioningDirty() {
         Q_Q(QQuickBasePositioner);
+        relayoutOnly = false;
         if (!positioningDirty) {
             positioningDirty = true;
             q->polish();
         }
     }
+    void itemSizeChanged(QQuickItem *item, const QRectF &oldGeometry);
+    void relayout();
+
+    // The first positioned item whose position may have changed. Items before it
+    // keep their position, so doPositioning() only needs to move the ones after it.
+    int firstDirtyIndex;
 
     bool positioningDirty : 1;
+    bool relayoutOnly : 1;
     bool doingPositioning : 1;
     bool anchorConflict : 1;
 
@@ -138,10 +146,10 @@ public:
         setPositioningDirty();
     }
 
-    void itemGeometryChanged(QQuickItem *, QQuickGeometryChange change, const QRectF &) override
+    void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override
     {
         if (change.sizeChange())
-            setPositioningDirty();
+            itemSizeChanged(item, oldGeometry);
     }
 
     void itemVisibilityChanged(QQuickItem *) override
@@ -54,6 +54,7 @@ QQuickRepeaterPrivate::QQuickRepeaterPrivate()
     , ownModel(false)
     , dataSourceIsObject(false)
     , delegateValidated(false)
+    , reuseItems(false)
     , itemCount(0)
 {
     setTransparentForPositioner(true);
@@ -206,12 +207,16 @@ void QQuickRepeater::setModel(const QVariant &m)
 
     clear();
     if (d->model) {
+        if (d->reuseItems)
+            d->model->drainReusableItemsPool(0);
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(modelUpdated(QQmlChangeSet,bool)),
                 this, QQuickRepeater, SLOT(modelUpdated(QQmlChangeSet,bool)));
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(createdItem(int,QObject*)),
                 this, QQuickRepeater, SLOT(createdItem(int,QObject*)));
         qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                 this, QQuickRepeater, SLOT(initItem(int,QObject*)));
+        qmlobject_disconnect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                this, QQuickRepeater, SLOT(reusedItem(int,QObject*)));
     }
     d->dataSource = model;
     QObject *object = qvariant_cast<QObject*>(model);
@@ -241,6 +246,8 @@ void QQuickRepeater::setModel(const QVariant &m)
                 this, QQuickRepeater, SLOT(createdItem(int,QObject*)));
         qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(initItem(int,QObject*)),
                 this, QQuickRepeater, SLOT(initItem(int,QObject*)));
+        qmlobject_connect(d->model, QQmlInstanceModel, SIGNAL(itemReused(int,QObject*)),
+                this, QQuickRepeater, SLOT(reusedItem(int,QObject*)));
         regenerate();
     }
     emit modelChanged();
@@ -328,6 +335,46 @@ int QQuickRepeater::count() const
     return 0;
 }
 
+/*!
+    \qmlproperty bool QtQuick::Repeater::reuseItems
+    \since 5.11
+
+    This property holds whether delegate items that are removed are reused for
+    items that are added.
+
+    When \c true, a delegate item that is removed because its model entry was
+    removed, or because the model was reset, is not destroyed but kept in a
+    pool, and handed out again for the next entry that is added before the
+    next frame, instead of incubating a new one. This avoids recreating all
+    delegates when a model is reset or refilled with new data. Items that are
+    not reused by the next frame are destroyed.
+
+    A reused item keeps all its state apart from \c index and the model roles,
+    which are rebound to the new index. Delegates that hold other state must
+    reset it when the item is announced again through \l itemAdded(). Items
+    are only reused with QAbstractItemModel based models, such as ListModel,
+    and with integer or array models.
+
+    The default value is \c false.
+*/
+bool QQuickRepeater::reuseItems() const
+{
+    Q_D(const QQuickRepeater);
+    return d->reuseItems;
+}
+
+void QQuickRepeater::setReuseItems(bool reuse)
+{
+    Q_D(QQuickRepeater);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model)
+        d->model->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
 /*!
     \qmlmethod Item QtQuick::Repeater::itemAt(index)
 
@@ -353,6 +400,15 @@ void QQuickRepeater::componentComplete()
         emit countChanged();
 }
 
+void QQuickRepeater::updatePolish()
+{
+    Q_D(QQuickRepeater);
+    QQuickItem::updatePolish();
+    // Pooled items that no insertion picked up since they were removed.
+    if (d->model)
+        d->model->drainReusableItemsPool(0);
+}
+
 void QQuickRepeater::itemChange(ItemChange change, const ItemChangeData &value)
 {
     QQuickItem::itemChange(change, value);
@@ -373,7 +429,7 @@ void QQuickRepeater::clear()
             if (QQuickItem *item = d->deletables.at(i)) {
                 if (complete)
                     emit itemRemoved(i, item);
-                d->model->release(item);
+                d->releaseItem(item);
             }
         }
         for (QQuickItem *item : qAsConst(d->deletables)) {
@@ -401,6 +457,15 @@ void QQuickRepeater::regenerate()
     d->requestItems();
 }
 
+void QQuickRepeaterPrivate::releaseItem(QQuickItem *item)
+{
+    Q_Q(QQuickRepeater);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item,
+            reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
+    if (flags & QQmlInstanceModel::Pooled)
+        q->polish();
+}
+
 void QQuickRepeaterPrivate::requestItems()
 {
     for (int i = 0; i < itemCount; i++) {
@@ -418,6 +483,18 @@ void QQuickRepeater::createdItem(int index, QObject *)
     emit itemAdded(index, item);
 }
 
+/*
+  A pooled item handed out again by the model doesn't go through createdItem()
+  and initItem(), so take the reference createdItem() would and put it in place.
+*/
+void QQuickRepeater::reusedItem(int index, QObject *)
+{
+    Q_D(QQuickRepeater);
+    QObject *object = d->model->object(index, QQmlIncubator::AsynchronousIfNested);
+    initItem(index, object);
+    emit itemAdded(index, qmlobject_cast<QQuickItem*>(object));
+}
+
 void QQuickRepeater::initItem(int index, QObject *object)
 {
     Q_D(QQuickRepeater);
@@ -481,7 +558,7 @@ void QQuickRepeater::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
             d->deletables.remove(index);
             emit itemRemoved(index, item);
             if (item) {
-                d->model->release(item);
+                d->releaseItem(item);
                 item->setParentItem(nullptr);
             }
             --d->itemCount;
@@ -69,6 +69,7 @@ class Q_AUTOTEST_EXPORT QQuickRepeater : public QQuickItem
     Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
     Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
     Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 11)
     Q_CLASSINFO("DefaultProperty", "delegate")
 
 public:
@@ -83,12 +84,16 @@ public:
 
     int count() const;
 
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
     Q_INVOKABLE QQuickItem *itemAt(int index) const;
 
 Q_SIGNALS:
     void modelChanged();
     void delegateChanged();
     void countChanged();
+    Q_REVISION(11) void reuseItemsChanged();
 
     void itemAdded(int index, QQuickItem *item);
     void itemRemoved(int index, QQuickItem *item);
@@ -99,11 +104,13 @@ private:
 
 protected:
     void componentComplete() override;
+    void updatePolish() override;
     void itemChange(ItemChange change, const ItemChangeData &value) override;
 
 private Q_SLOTS:
     void createdItem(int index, QObject *item);
     void initItem(int, QObject *item);
+    void reusedItem(int index, QObject *item);
     void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
 
 private:
@@ -72,6 +72,7 @@ public:
 
 private:
     void requestItems();
+    void releaseItem(QQuickItem *item);
 
     QPointer<QQmlInstanceModel> model;
     QVariant dataSource;
@@ -79,6 +80,7 @@ private:
     bool ownModel : 1;
     bool dataSourceIsObject : 1;
     bool delegateValidated : 1;
+    bool reuseItems : 1;
     int itemCount;
 
     QVector<QPointer<QQuickItem> > deletables;
@@ -0,0 +1,863 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qquicktableview_p_p.h"
+
+#include <QtQml/qjsvalue.h>
+#include <QtQml/qqmlinfo.h>
+#include <QtQml/private/qqmlchangeset_p.h>
+#include <QtQuick/private/qquickitem_p.h>
+
+QT_BEGIN_NAMESPACE
+
+#ifndef QML_VIEW_DEFAULTCACHEBUFFER
+#define QML_VIEW_DEFAULTCACHEBUFFER 320
+#endif
+
+/*!
+    \qmltype TableView
+    \instantiates QQuickTableView
+    \inqmlmodule QtQuick
+    \ingroup qtquick-views
+    \inherits Flickable
+    \since 5.11
+    \brief Provides a table view of items provided by a model.
+
+    A TableView displays data from models created from the rows and columns
+    of a QAbstractItemModel, or from a simple list or integer model, in which
+    case the table has a single column.
+
+    Like \l ListView and \l GridView, TableView only creates delegate items
+    for the cells that are visible, plus the cells within \l cacheBuffer of
+    the viewport, and releases the items of cells that are flicked out of
+    view. With \l reuseItems enabled, released items are kept in a pool and
+    rebound to the cells that are flicked into view, which avoids creating
+    a new delegate for every cell that becomes visible.
+
+    The width of a column is the largest \c implicitWidth of the delegate
+    items in that column when the column is first loaded, and the height of
+    a row is determined the same way from the items in that row. The sizes
+    are cached, so a row or column keeps its size while it is flicked in and
+    out of view. Rows and columns that have not been loaded yet are assumed
+    to have the average size of those that have, which is used to estimate
+    the size of the content.
+
+    Each delegate item can access the cell it displays through the attached
+    properties \c TableView.row and \c TableView.column, and the model roles
+    of that cell as with the other views.
+
+    \code
+    TableView {
+        anchors.fill: parent
+        columnSpacing: 1
+        rowSpacing: 1
+        model: myTableModel
+
+        delegate: Rectangle {
+            implicitWidth: 100
+            implicitHeight: 30
+            Text { text: display }
+        }
+    }
+    \endcode
+
+    Changes to the row or column structure of the model, such as inserted or
+    removed rows, reset the table. Changes to the data of a cell update the
+    delegate item of that cell in place.
+
+    \sa ListView, GridView, {qml-data-models}{Data Models}
+*/
+
+/*!
+    \qmlattachedproperty TableView QtQuick::TableView::view
+    This attached property holds the view that manages this delegate instance.
+*/
+
+/*!
+    \qmlattachedproperty int QtQuick::TableView::row
+    This attached property holds the row of the cell this delegate instance
+    displays.
+*/
+
+/*!
+    \qmlattachedproperty int QtQuick::TableView::column
+    This attached property holds the column of the cell this delegate
+    instance displays.
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::TableView::pooled()
+
+    This attached signal is emitted after an item has been released from the
+    view and parked in the reuse pool. The corresponding handler is
+    \c onPooled.
+
+    \sa reused(), reuseItems
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::TableView::reused()
+
+    This attached signal is emitted after a pooled item has been bound to a
+    new cell. The attached \c row and \c column properties and the model
+    roles have already been updated when the signal is emitted. The
+    corresponding handler is \c onReused.
+
+    \sa pooled(), reuseItems
+*/
+
+const qreal QQuickTableViewPrivate::DefaultCellSize = 100;
+
+static qreal implicitCellWidth(QQuickItem *item)
+{
+    const qreal width = item->implicitWidth();
+    return width > 0 ? width : item->width();
+}
+
+static qreal implicitCellHeight(QQuickItem *item)
+{
+    const qreal height = item->implicitHeight();
+    return height > 0 ? height : item->height();
+}
+
+QQuickTableViewPrivate::QQuickTableViewPrivate()
+    : tableModel(nullptr)
+    , loadedLeftX(0)
+    , loadedTopY(0)
+    , knownColumnWidths(0)
+    , knownColumnCount(0)
+    , knownRowHeights(0)
+    , knownRowCount(0)
+    , rowCount(0)
+    , columnCount(0)
+    , rowSpacing(0)
+    , columnSpacing(0)
+    , cacheBuffer(QML_VIEW_DEFAULTCACHEBUFFER)
+    , reuseItems(true)
+    , inUpdateTable(false)
+{
+}
+
+QQuickTableViewPrivate::~QQuickTableViewPrivate()
+{
+}
+
+void QQuickTableViewPrivate::ensureModel()
+{
+    Q_Q(QQuickTableView);
+    if (tableModel)
+        return;
+
+    QQmlContext *context = qmlContext(q);
+    if (!context)
+        return;
+
+    tableModel = new QQmlTableInstanceModel(context, q);
+    QObject::connect(tableModel, SIGNAL(initItem(int,QObject*)), q, SLOT(initItem(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(createdItem(int,QObject*)), q, SLOT(createdItem(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(itemReused(int,QObject*)), q, SLOT(itemReused(int,QObject*)));
+    QObject::connect(tableModel, SIGNAL(modelUpdated(QQmlChangeSet,bool)),
+                     q, SLOT(modelUpdated(QQmlChangeSet,bool)));
+}
+
+void QQuickTableViewPrivate::resetSizeCache()
+{
+    columnWidths.fill(-1, columnCount);
+    rowHeights.fill(-1, rowCount);
+    knownColumnWidths = 0;
+    knownColumnCount = 0;
+    knownRowHeights = 0;
+    knownRowCount = 0;
+}
+
+qreal QQuickTableViewPrivate::averageColumnWidth() const
+{
+    return knownColumnCount ? knownColumnWidths / knownColumnCount : DefaultCellSize;
+}
+
+qreal QQuickTableViewPrivate::averageRowHeight() const
+{
+    return knownRowCount ? knownRowHeights / knownRowCount : DefaultCellSize;
+}
+
+qreal QQuickTableViewPrivate::columnX(int column) const
+{
+    qreal x = loadedLeftX;
+    for (int c = loadedTable.left(); c < column; ++c)
+        x += columnWidths.at(c) + columnSpacing;
+    return x;
+}
+
+qreal QQuickTableViewPrivate::rowY(int row) const
+{
+    qreal y = loadedTopY;
+    for (int r = loadedTable.top(); r < row; ++r)
+        y += rowHeights.at(r) + rowSpacing;
+    return y;
+}
+
+void QQuickTableViewPrivate::releaseItem(QQuickItem *item)
+{
+    const QQmlInstanceModel::ReleaseFlags flags = tableModel->release(item,
+            reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
+
+    if (flags & QQmlInstanceModel::Destroyed) {
+        item->setParentItem(nullptr);
+    } else {
+        // Pooled, or still referenced from elsewhere
+        QQuickItemPrivate::get(item)->setCulled(true);
+        if (flags & QQmlInstanceModel::Pooled) {
+            if (QQuickTableViewAttached *attached = static_cast<QQuickTableViewAttached *>(
+                        qmlAttachedPropertiesObject<QQuickTableView>(item, false)))
+                attached->emitPooled();
+        }
+    }
+}
+
+void QQuickTableViewPrivate::releaseCell(int row, int column)
+{
+    if (QQuickItem *item = loadedItems.take(cellKey(row, column)))
+        releaseItem(item);
+}
+
+void QQuickTableViewPrivate::releaseLoadedItems()
+{
+    // Handlers of the attached pooled() signal may call back into the view
+    const QHash<qint64, QQuickItem *> items = loadedItems;
+    loadedItems.clear();
+    loadedTable = QRect();
+    pendingEdge = QRect();
+    for (QQuickItem *item : items)
+        releaseItem(item);
+}
+
+QQuickItem *QQuickTableViewPrivate::loadCell(int row, int column)
+{
+    Q_Q(QQuickTableView);
+    const qint64 key = cellKey(row, column);
+    if (QQuickItem *item = loadedItems.value(key))
+        return item;
+
+    QObject *object = tableModel->object(row, column, QQmlIncubator::AsynchronousIfNested);
+    if (!object)
+        return nullptr;
+
+    QQuickItem *item = qmlobject_cast<QQuickItem *>(object);
+    if (!item) {
+        tableModel->release(object);
+        qmlWarning(q) << "TableView: delegate must be of Item type";
+        return nullptr;
+    }
+
+    QQuickItemPrivate::get(item)->setCulled(false);
+    loadedItems.insert(key, item);
+    return item;
+}
+
+bool QQuickTableViewPrivate::loadColumn(int column)
+{
+    bool complete = true;
+    qreal width = 0;
+    for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row) {
+        if (QQuickItem *item = loadCell(row, column))
+            width = qMax(width, implicitCellWidth(item));
+        else
+            complete = false;
+    }
+
+    if (!complete) {
+        // Wait for createdItem() rather than showing half a column
+        pendingEdge = QRect(column, loadedTable.top(), 1, loadedTable.height());
+        return false;
+    }
+    pendingEdge = QRect();
+
+    if (columnWidths.at(column) < 0) {
+        columnWidths[column] = width > 0 ? width : DefaultCellSize;
+        knownColumnWidths += columnWidths.at(column);
+        ++knownColumnCount;
+    }
+
+    if (column < loadedTable.left()) {
+        loadedLeftX -= columnWidths.at(column) + columnSpacing;
+        loadedTable.setLeft(column);
+    } else {
+        loadedTable.setRight(column);
+    }
+    return true;
+}
+
+bool QQuickTableViewPrivate::loadRow(int row)
+{
+    bool complete = true;
+    qreal height = 0;
+    for (int column = loadedTable.left(); column <= loadedTable.right(); ++column) {
+        if (QQuickItem *item = loadCell(row, column))
+            height = qMax(height, implicitCellHeight(item));
+        else
+            complete = false;
+    }
+
+    if (!complete) {
+        pendingEdge = QRect(loadedTable.left(), row, loadedTable.width(), 1);
+        return false;
+    }
+    pendingEdge = QRect();
+
+    if (rowHeights.at(row) < 0) {
+        rowHeights[row] = height > 0 ? height : DefaultCellSize;
+        knownRowHeights += rowHeights.at(row);
+        ++knownRowCount;
+    }
+
+    if (row < loadedTable.top()) {
+        loadedTopY -= rowHeights.at(row) + rowSpacing;
+        loadedTable.setTop(row);
+    } else {
+        loadedTable.setBottom(row);
+    }
+    return true;
+}
+
+void QQuickTableViewPrivate::unloadColumn(int column)
+{
+    for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row)
+        releaseCell(row, column);
+
+    if (column == loadedTable.left()) {
+        loadedLeftX += columnWidths.at(column) + columnSpacing;
+        loadedTable.setLeft(column + 1);
+    } else {
+        loadedTable.setRight(column - 1);
+    }
+}
+
+void QQuickTableViewPrivate::unloadRow(int row)
+{
+    for (int column = loadedTable.left(); column <= loadedTable.right(); ++column)
+        releaseCell(row, column);
+
+    if (row == loadedTable.top()) {
+        loadedTopY += rowHeights.at(row) + rowSpacing;
+        loadedTable.setTop(row + 1);
+    } else {
+        loadedTable.setBottom(row - 1);
+    }
+}
+
+bool QQuickTableViewPrivate::rebuildTable(const QRectF &area)
+{
+    // Nothing that is loaded is close to the viewport, for instance after a
+    // reset or a jump of contentX/Y. Start again from the cell estimated to
+    // be at the top left corner of the viewport.
+    const qreal columnStride = averageColumnWidth() + columnSpacing;
+    const qreal rowStride = averageRowHeight() + rowSpacing;
+    const int column = qBound(0, int(qMax<qreal>(0, area.left() + cacheBuffer) / columnStride), columnCount - 1);
+    const int row = qBound(0, int(qMax<qreal>(0, area.top() + cacheBuffer) / rowStride), rowCount - 1);
+
+    QQuickItem *item = loadCell(row, column);
+    if (!item) {
+        pendingEdge = QRect(column, row, 1, 1);
+        return false;
+    }
+    pendingEdge = QRect();
+
+    loadedTable = QRect(column, row, 1, 1);
+    loadedLeftX = column * columnStride;
+    loadedTopY = row * rowStride;
+
+    if (columnWidths.at(column) < 0) {
+        const qreal width = implicitCellWidth(item);
+        columnWidths[column] = width > 0 ? width : DefaultCellSize;
+        knownColumnWidths += columnWidths.at(column);
+        ++knownColumnCount;
+    }
+    if (rowHeights.at(row) < 0) {
+        const qreal height = implicitCellHeight(item);
+        rowHeights[row] = height > 0 ? height : DefaultCellSize;
+        knownRowHeights += rowHeights.at(row);
+        ++knownRowCount;
+    }
+    return true;
+}
+
+void QQuickTableViewPrivate::layoutTable()
+{
+    qreal y = loadedTopY;
+    for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row) {
+        const qreal height = rowHeights.at(row);
+        qreal x = loadedLeftX;
+        for (int column = loadedTable.left(); column <= loadedTable.right(); ++column) {
+            const qreal width = columnWidths.at(column);
+            if (QQuickItem *item = loadedItems.value(cellKey(row, column))) {
+                item->setPosition(QPointF(x, y));
+                item->setSize(QSizeF(width, height));
+            }
+            x += width + columnSpacing;
+        }
+        y += height + rowSpacing;
+    }
+}
+
+void QQuickTableViewPrivate::updateContentSize()
+{
+    Q_Q(QQuickTableView);
+    qreal width = 0;
+    qreal height = 0;
+    if (loadedTable.isEmpty()) {
+        if (columnCount > 0)
+            width = columnCount * (averageColumnWidth() + columnSpacing) - columnSpacing;
+        if (rowCount > 0)
+            height = rowCount * (averageRowHeight() + rowSpacing) - rowSpacing;
+    } else {
+        // Exact up to the last loaded column and row, estimated after that
+        const int columnsAfter = columnCount - 1 - loadedTable.right();
+        const int rowsAfter = rowCount - 1 - loadedTable.bottom();
+        width = loadedRightEdge() + columnsAfter * (averageColumnWidth() + columnSpacing);
+        height = loadedBottomEdge() + rowsAfter * (averageRowHeight() + rowSpacing);
+    }
+
+    if (!qFuzzyCompare(q->contentWidth(), width))
+        q->setContentWidth(width);
+    if (!qFuzzyCompare(q->contentHeight(), height))
+        q->setContentHeight(height);
+}
+
+void QQuickTableViewPrivate::updateTable()
+{
+    Q_Q(QQuickTableView);
+    if (!q->isComponentComplete() || !tableModel)
+        return;
+    if (inUpdateTable) {
+        // Moving the viewport from within the update, finish on the next polish
+        q->polish();
+        return;
+    }
+
+    if (rowCount == 0 || columnCount == 0 || !tableModel->delegate()) {
+        releaseLoadedItems();
+        updateContentSize();
+        return;
+    }
+
+    inUpdateTable = true;
+
+    const QRectF area = QRectF(q->contentX(), q->contentY(), q->width(), q->height())
+            .adjusted(-cacheBuffer, -cacheBuffer, cacheBuffer, cacheBuffer);
+
+    bool complete = true;
+    if (loadedTable.isEmpty()
+            || loadedRightEdge() <= area.left() || loadedLeftX >= area.right()
+            || loadedBottomEdge() <= area.top() || loadedTopY >= area.bottom()) {
+        releaseLoadedItems();
+        complete = rebuildTable(area);
+    }
+
+    bool changed = complete;
+    while (complete && changed) {
+        changed = false;
+
+        // Release the edges that have left the area first, so that their
+        // items can be reused for the edges that are about to be loaded.
+        while (loadedTable.width() > 1 && columnX(loadedTable.left() + 1) <= area.left())
+            unloadColumn(loadedTable.left());
+        while (loadedTable.width() > 1 && columnX(loadedTable.right()) >= area.right())
+            unloadColumn(loadedTable.right());
+        while (loadedTable.height() > 1 && rowY(loadedTable.top() + 1) <= area.top())
+            unloadRow(loadedTable.top());
+        while (loadedTable.height() > 1 && rowY(loadedTable.bottom()) >= area.bottom())
+            unloadRow(loadedTable.bottom());
+
+        if (loadedTable.right() < columnCount - 1 && loadedRightEdge() + columnSpacing < area.right())
+            changed = complete = loadColumn(loadedTable.right() + 1);
+        else if (loadedTable.left() > 0 && loadedLeftX > area.left())
+            changed = complete = loadColumn(loadedTable.left() - 1);
+        else if (loadedTable.bottom() < rowCount - 1 && loadedBottomEdge() + rowSpacing < area.bottom())
+            changed = complete = loadRow(loadedTable.bottom() + 1);
+        else if (loadedTable.top() > 0 && loadedTopY > area.top())
+            changed = complete = loadRow(loadedTable.top() - 1);
+    }
+
+    // Cells created for an edge that is no longer wanted
+    for (auto it = loadedItems.begin(); it != loadedItems.end();) {
+        const QPoint cell = QQmlTableInstanceModel::cellAt(it.key());
+        if (loadedTable.contains(cell) || pendingEdge.contains(cell)) {
+            ++it;
+        } else {
+            QQuickItem *item = it.value();
+            it = loadedItems.erase(it);
+            releaseItem(item);
+        }
+    }
+
+    if (!loadedTable.isEmpty()) {
+        // The positions of the columns and rows before the loaded ones are
+        // estimates. Once the first one is loaded, move everything so that
+        // it starts at 0, and keep the viewport where it was relative to it.
+        const qreal dx = loadedTable.left() == 0 ? loadedLeftX : 0;
+        const qreal dy = loadedTable.top() == 0 ? loadedTopY : 0;
+        loadedLeftX -= dx;
+        loadedTopY -= dy;
+        layoutTable();
+        updateContentSize();
+        if (!qFuzzyIsNull(dx))
+            q->setContentX(q->contentX() - dx);
+        if (!qFuzzyIsNull(dy))
+            q->setContentY(q->contentY() - dy);
+    }
+
+    tableModel->drainReusableItemsPool(MaxReusePoolTime);
+    inUpdateTable = false;
+}
+
+QQuickTableView::QQuickTableView(QQuickItem *parent)
+    : QQuickFlickable(*(new QQuickTableViewPrivate), parent)
+{
+    setFlag(QQuickItem::ItemIsFocusScope);
+}
+
+QQuickTableView::~QQuickTableView()
+{
+    Q_D(QQuickTableView);
+    // The model owns the delegate items
+    d->loadedItems.clear();
+    delete d->tableModel;
+    d->tableModel = nullptr;
+}
+
+int QQuickTableView::rows() const
+{
+    Q_D(const QQuickTableView);
+    return d->rowCount;
+}
+
+int QQuickTableView::columns() const
+{
+    Q_D(const QQuickTableView);
+    return d->columnCount;
+}
+
+/*!
+    \qmlproperty real QtQuick::TableView::rowSpacing
+    \qmlproperty real QtQuick::TableView::columnSpacing
+
+    These properties hold the spacing between the rows and between the
+    columns of the table. The default value is \c 0.
+*/
+qreal QQuickTableView::rowSpacing() const
+{
+    Q_D(const QQuickTableView);
+    return d->rowSpacing;
+}
+
+void QQuickTableView::setRowSpacing(qreal spacing)
+{
+    Q_D(QQuickTableView);
+    if (qFuzzyCompare(d->rowSpacing, spacing))
+        return;
+
+    d->rowSpacing = spacing;
+    polish();
+    emit rowSpacingChanged();
+}
+
+qreal QQuickTableView::columnSpacing() const
+{
+    Q_D(const QQuickTableView);
+    return d->columnSpacing;
+}
+
+void QQuickTableView::setColumnSpacing(qreal spacing)
+{
+    Q_D(QQuickTableView);
+    if (qFuzzyCompare(d->columnSpacing, spacing))
+        return;
+
+    d->columnSpacing = spacing;
+    polish();
+    emit columnSpacingChanged();
+}
+
+/*!
+    \qmlproperty int QtQuick::TableView::rows
+    \qmlproperty int QtQuick::TableView::columns
+    \readonly
+
+    These properties hold the number of rows and columns in the model.
+*/
+
+/*!
+    \qmlproperty int QtQuick::TableView::cacheBuffer
+
+    This property determines whether delegates are retained outside the
+    visible area of the view.
+
+    If this value is greater than zero, the view may keep as many delegates
+    instantiated as will fit within the buffer specified, in each direction.
+    The buffer is specified in pixels, as for \l ListView::cacheBuffer.
+
+    The default value is 320.
+*/
+int QQuickTableView::cacheBuffer() const
+{
+    Q_D(const QQuickTableView);
+    return d->cacheBuffer;
+}
+
+void QQuickTableView::setCacheBuffer(int newBuffer)
+{
+    Q_D(QQuickTableView);
+    if (newBuffer < 0) {
+        qmlWarning(this) << "Cannot set a negative cache buffer";
+        return;
+    }
+
+    if (d->cacheBuffer == newBuffer)
+        return;
+
+    d->cacheBuffer = newBuffer;
+    polish();
+    emit cacheBufferChanged();
+}
+
+/*!
+    \qmlproperty bool QtQuick::TableView::reuseItems
+
+    This property holds whether the delegate items of cells that are flicked
+    out of view are kept in a pool and reused for the cells that are flicked
+    into view, instead of being destroyed and created again.
+
+    A reused item keeps any state that is not bound to the model roles or to
+    the attached \c row and \c column properties. Use the \l pooled() and
+    \l reused() attached signals to reset such state.
+
+    Items are only reused if the delegate has not changed, and only for
+    models whose data is exposed through roles.
+
+    The default value is \c true.
+*/
+bool QQuickTableView::reuseItems() const
+{
+    Q_D(const QQuickTableView);
+    return d->reuseItems;
+}
+
+void QQuickTableView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickTableView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->tableModel)
+        d->tableModel->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
+/*!
+    \qmlproperty model QtQuick::TableView::model
+    This property holds the model providing data for the table.
+
+    If the model is a QAbstractItemModel, the cells are the rows and columns
+    under its root index. Other models, such as a \l ListModel, a JavaScript
+    array or an integer, provide a single column.
+
+    \sa {qml-data-models}{Data Models}
+*/
+QVariant QQuickTableView::model() const
+{
+    Q_D(const QQuickTableView);
+    return d->modelVariant;
+}
+
+void QQuickTableView::setModel(const QVariant &newModel)
+{
+    Q_D(QQuickTableView);
+    QVariant model = newModel;
+    if (model.userType() == qMetaTypeId<QJSValue>())
+        model = model.value<QJSValue>().toVariant();
+
+    if (d->modelVariant == model)
+        return;
+
+    d->modelVariant = model;
+    if (d->tableModel)
+        d->tableModel->setModel(model);
+    emit modelChanged();
+}
+
+/*!
+    \qmlproperty Component QtQuick::TableView::delegate
+
+    The delegate provides a template defining each cell instantiated by the
+    view. The model roles of the cell are available to the delegate as with
+    the other views, and the cell itself through the attached \c row and
+    \c column properties.
+
+    The size of the columns and rows is taken from the implicit size of the
+    delegate items, see \l TableView.
+*/
+QQmlComponent *QQuickTableView::delegate() const
+{
+    Q_D(const QQuickTableView);
+    return d->delegate;
+}
+
+void QQuickTableView::setDelegate(QQmlComponent *newDelegate)
+{
+    Q_D(QQuickTableView);
+    if (d->delegate == newDelegate)
+        return;
+
+    d->delegate = newDelegate;
+    if (d->tableModel)
+        d->tableModel->setDelegate(newDelegate);
+    emit delegateChanged();
+}
+
+QQuickTableViewAttached *QQuickTableView::qmlAttachedProperties(QObject *obj)
+{
+    return new QQuickTableViewAttached(obj);
+}
+
+void QQuickTableView::updatePolish()
+{
+    Q_D(QQuickTableView);
+    QQuickFlickable::updatePolish();
+    d->updateTable();
+}
+
+void QQuickTableView::componentComplete()
+{
+    Q_D(QQuickTableView);
+    QQuickFlickable::componentComplete();
+
+    d->ensureModel();
+    if (d->tableModel) {
+        d->tableModel->setDelegate(d->delegate);
+        d->tableModel->setModel(d->modelVariant);
+    }
+}
+
+void QQuickTableView::viewportMoved(Qt::Orientations orientation)
+{
+    Q_D(QQuickTableView);
+    QQuickFlickable::viewportMoved(orientation);
+    d->updateTable();
+}
+
+void QQuickTableView::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickFlickable::geometryChanged(newGeometry, oldGeometry);
+    polish();
+}
+
+void QQuickTableView::initItem(int index, QObject *object)
+{
+    // The index doesn't fit in an int for cells of large tables
+    Q_UNUSED(index);
+    QQuickItem *item = qmlobject_cast<QQuickItem *>(object);
+    if (!item)
+        return;
+
+    item->setParentItem(contentItem());
+    if (QQuickTableViewAttached *attached = static_cast<QQuickTableViewAttached *>(
+                qmlAttachedPropertiesObject<QQuickTableView>(item))) {
+        const QPoint cell = QQmlTableInstanceModel::cellOf(object);
+        attached->setView(this);
+        attached->setCell(cell.y(), cell.x());
+    }
+}
+
+void QQuickTableView::createdItem(int index, QObject *object)
+{
+    Q_D(QQuickTableView);
+    Q_UNUSED(index);
+    const QPoint cell = QQmlTableInstanceModel::cellOf(object);
+    const qint64 key = d->cellKey(cell.y(), cell.x());
+    // Items created synchronously are picked up by loadCell()
+    if (d->inUpdateTable || d->loadedItems.contains(key))
+        return;
+
+    if (!d->pendingEdge.contains(cell))
+        return;
+
+    // The model destroys the item right after this signal unless it is referenced
+    if (QQuickItem *item = qmlobject_cast<QQuickItem *>(d->tableModel->object(cell.y(), cell.x())))
+        d->loadedItems.insert(key, item);
+    polish();
+}
+
+void QQuickTableView::itemReused(int index, QObject *object)
+{
+    Q_UNUSED(index);
+    if (QQuickTableViewAttached *attached = static_cast<QQuickTableViewAttached *>(
+                qmlAttachedPropertiesObject<QQuickTableView>(object, false))) {
+        const QPoint cell = QQmlTableInstanceModel::cellOf(object);
+        attached->setCell(cell.y(), cell.x());
+        attached->emitReused();
+    }
+}
+
+void QQuickTableView::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
+{
+    Q_D(QQuickTableView);
+    // QQmlTableInstanceModel reports every structural change as a reset
+    Q_UNUSED(changeSet);
+    Q_UNUSED(reset);
+
+    d->releaseLoadedItems();
+
+    const int oldRowCount = d->rowCount;
+    const int oldColumnCount = d->columnCount;
+    d->rowCount = d->tableModel->rows();
+    d->columnCount = d->tableModel->columns();
+    d->resetSizeCache();
+    polish();
+
+    if (d->rowCount != oldRowCount)
+        emit rowsChanged();
+    if (d->columnCount != oldColumnCount)
+        emit columnsChanged();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qquicktableview_p.cpp"
@@ -0,0 +1,192 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQUICKTABLEVIEW_P_H
+#define QQUICKTABLEVIEW_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+QT_REQUIRE_CONFIG(quick_tableview);
+
+#include "qquickflickable_p.h"
+
+#include <QtQml/qqml.h>
+#include <QtCore/qpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQmlChangeSet;
+class QQuickTableViewAttached;
+class QQuickTableViewPrivate;
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableView : public QQuickFlickable
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int rows READ rows NOTIFY rowsChanged)
+    Q_PROPERTY(int columns READ columns NOTIFY columnsChanged)
+    Q_PROPERTY(qreal rowSpacing READ rowSpacing WRITE setRowSpacing NOTIFY rowSpacingChanged)
+    Q_PROPERTY(qreal columnSpacing READ columnSpacing WRITE setColumnSpacing NOTIFY columnSpacingChanged)
+    Q_PROPERTY(int cacheBuffer READ cacheBuffer WRITE setCacheBuffer NOTIFY cacheBufferChanged)
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged)
+
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
+
+public:
+    QQuickTableView(QQuickItem *parent = nullptr);
+    ~QQuickTableView() override;
+
+    int rows() const;
+    int columns() const;
+
+    qreal rowSpacing() const;
+    void setRowSpacing(qreal spacing);
+
+    qreal columnSpacing() const;
+    void setColumnSpacing(qreal spacing);
+
+    int cacheBuffer() const;
+    void setCacheBuffer(int newBuffer);
+
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
+    QVariant model() const;
+    void setModel(const QVariant &newModel);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *);
+
+    static QQuickTableViewAttached *qmlAttachedProperties(QObject *);
+
+Q_SIGNALS:
+    void rowsChanged();
+    void columnsChanged();
+    void rowSpacingChanged();
+    void columnSpacingChanged();
+    void cacheBufferChanged();
+    void reuseItemsChanged();
+    void modelChanged();
+    void delegateChanged();
+
+protected:
+    void updatePolish() override;
+    void componentComplete() override;
+    void viewportMoved(Qt::Orientations orientation) override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private Q_SLOTS:
+    void initItem(int index, QObject *object);
+    void createdItem(int index, QObject *object);
+    void itemReused(int index, QObject *object);
+    void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
+
+private:
+    Q_DISABLE_COPY(QQuickTableView)
+    Q_DECLARE_PRIVATE(QQuickTableView)
+};
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableViewAttached : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QQuickTableView *view READ view NOTIFY viewChanged)
+    Q_PROPERTY(int row READ row NOTIFY rowChanged)
+    Q_PROPERTY(int column READ column NOTIFY columnChanged)
+
+public:
+    QQuickTableViewAttached(QObject *parent)
+        : QObject(parent), m_row(-1), m_column(-1) {}
+
+    QQuickTableView *view() const { return m_view; }
+    void setView(QQuickTableView *view) {
+        if (view != m_view) {
+            m_view = view;
+            Q_EMIT viewChanged();
+        }
+    }
+
+    int row() const { return m_row; }
+    int column() const { return m_column; }
+    void setCell(int row, int column) {
+        const bool rowChange = row != m_row;
+        const bool columnChange = column != m_column;
+        m_row = row;
+        m_column = column;
+        if (rowChange)
+            Q_EMIT rowChanged();
+        if (columnChange)
+            Q_EMIT columnChanged();
+    }
+
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
+
+Q_SIGNALS:
+    void viewChanged();
+    void rowChanged();
+    void columnChanged();
+    void pooled();
+    void reused();
+
+private:
+    QPointer<QQuickTableView> m_view;
+    int m_row;
+    int m_column;
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickTableView)
+QML_DECLARE_TYPEINFO(QQuickTableView, QML_HAS_ATTACHED_PROPERTIES)
+
+#endif // QQUICKTABLEVIEW_P_H
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQUICKTABLEVIEW_P_P_H
+#define QQUICKTABLEVIEW_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qquicktableview_p.h"
+
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
+#include <QtQml/private/qqmltableinstancemodel_p.h>
+#include <QtQuick/private/qquickflickable_p_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICK_PRIVATE_EXPORT QQuickTableViewPrivate : public QQuickFlickablePrivate
+{
+    Q_DECLARE_PUBLIC(QQuickTableView)
+
+public:
+    QQuickTableViewPrivate();
+    ~QQuickTableViewPrivate() override;
+
+    static inline QQuickTableViewPrivate *get(QQuickTableView *q) { return q->d_func(); }
+
+    void ensureModel();
+    void updateTable();
+    void releaseLoadedItems();
+    void resetSizeCache();
+
+    bool loadColumn(int column);
+    bool loadRow(int row);
+    QQuickItem *loadCell(int row, int column);
+    void unloadColumn(int column);
+    void unloadRow(int row);
+    void releaseCell(int row, int column);
+    void releaseItem(QQuickItem *item);
+
+    bool rebuildTable(const QRectF &area);
+    void layoutTable();
+    void updateContentSize();
+
+    qreal averageColumnWidth() const;
+    qreal averageRowHeight() const;
+    qreal columnX(int column) const;
+    qreal rowY(int row) const;
+    qreal loadedRightEdge() const { return columnX(loadedTable.right()) + columnWidths.at(loadedTable.right()); }
+    qreal loadedBottomEdge() const { return rowY(loadedTable.bottom()) + rowHeights.at(loadedTable.bottom()); }
+
+    static qint64 cellKey(int row, int column) { return QQmlTableInstanceModel::cellKey(row, column); }
+
+    QQmlTableInstanceModel *tableModel;
+    QVariant modelVariant;
+    QPointer<QQmlComponent> delegate;
+
+    // Items of the cells in loadedTable, and of the cells of pendingEdge
+    // that have been created while the rest of that edge is incubating.
+    QHash<qint64, QQuickItem *> loadedItems; // By cellKey()
+    QRect loadedTable;
+    QRect pendingEdge;
+    qreal loadedLeftX;
+    qreal loadedTopY;
+
+    // A column or row gets its size from the cells loaded with it the first
+    // time it is loaded. The size is kept until the model is reset, so that
+    // flicking back and forth does not make the table jump. -1 means unknown.
+    QVector<qreal> columnWidths;
+    QVector<qreal> rowHeights;
+    qreal knownColumnWidths;
+    int knownColumnCount;
+    qreal knownRowHeights;
+    int knownRowCount;
+
+    int rowCount;
+    int columnCount;
+    qreal rowSpacing;
+    qreal columnSpacing;
+    int cacheBuffer;
+
+    bool reuseItems : 1;
+    bool inUpdateTable : 1;
+
+    static const int MaxReusePoolTime = 2;
+    static const qreal DefaultCellSize;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTABLEVIEW_P_P_H
@@ -50,6 +50,7 @@
 
 #include <QtQuick/private/qsgrenderer_p.h>
 #include <QtQuick/private/qsgtexture_p.h>
+#include <QtQuick/private/qsgdistancefieldglyphstore_p.h>
 #include <private/qsgrenderloop_p.h>
 #include <private/qquickrendercontrol_p.h>
 #include <private/qquickanimatorcontroller_p.h>
@@ -63,6 +64,7 @@
 #include <QtGui/qpainter.h>
 #include <QtGui/qevent.h>
 #include <QtGui/qmatrix4x4.h>
+#include <QtGui/qtextlayout.h>
 #include <QtCore/qvarlengtharray.h>
 #include <QtCore/qabstractanimation.h>
 #include <QtCore/QLibraryInfo>
@@ -476,14 +478,96 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
             renderer->setViewportRect(rect);
             renderer->setProjectionMatrixToRect(QRect(QPoint(0, 0), size));
             renderer->setDevicePixelRatio(devicePixelRatio);
+#if QT_CONFIG(opengl)
+            fboId = partialUpdateFramebuffer(rect.size());
+#endif
         }
 
+        renderer->setPartialUpdatesEnabled(fboId && !renderTargetId);
         context->renderNextFrame(renderer, fboId);
+#if QT_CONFIG(opengl)
+        if (renderer->partialUpdatesEnabled())
+            presentPartialUpdate(renderer->damageRect());
+#endif
+
+        QMutexLocker locker(&rendererStatisticsMutex);
+        lastFrameStatistics = renderer->statistics();
     }
     emit q->afterRendering();
     runAndClearJobs(&afterRenderingJobs);
 }
 
+#if QT_CONFIG(opengl)
+/*
+    Returns the framebuffer object to render the window into when partial
+    updates are enabled, or 0 to render directly to the window.
+
+    The framebuffer object keeps its content between frames, so the renderer
+    only has to repaint what changed, whatever the platform does with the
+    window's back buffer on swap. Partial updates are not used when content
+    is drawn underneath the scene through beforeRendering(), as that goes to
+    the window, nor with QQuickRenderControl, which renders into whatever
+    framebuffer the application has bound.
+*/
+uint QQuickWindowPrivate::partialUpdateFramebuffer(const QSize &size)
+{
+    QOpenGLContext *ctx = QOpenGLContext::currentContext();
+    if (!partialUpdates || !clearBeforeRendering || renderControl || !ctx
+            || !QOpenGLFramebufferObject::hasOpenGLFramebufferBlit()) {
+        delete partialUpdateFbo;
+        partialUpdateFbo = nullptr;
+        return 0;
+    }
+
+    if (!partialUpdateFbo || partialUpdateFbo->size() != size) {
+        delete partialUpdateFbo;
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setSamples(ctx->format().samples());
+        partialUpdateFbo = new QOpenGLFramebufferObject(size, format);
+        if (!partialUpdateFbo->isValid()) {
+            qWarning("QQuickWindow: Failed to create framebuffer for partial updates, disabling them");
+            delete partialUpdateFbo;
+            partialUpdateFbo = nullptr;
+            partialUpdates = false;
+            return 0;
+        }
+    }
+    return partialUpdateFbo->handle();
+}
+
+/*
+    Copies the frame rendered into the partial update framebuffer to the
+    window. With QSG_VISUALIZE=damage, the repainted \a rect is outlined in
+    the window, but not in the framebuffer, so it doesn't stay around.
+*/
+void QQuickWindowPrivate::presentPartialUpdate(const QRect &rect)
+{
+    const QRect bounds(QPoint(0, 0), partialUpdateFbo->size());
+    QOpenGLFramebufferObject::blitFramebuffer(nullptr, bounds, partialUpdateFbo, bounds);
+    QOpenGLFramebufferObject::bindDefault();
+
+    if (customRenderMode != "damage" || rect.isEmpty())
+        return;
+
+    QOpenGLFunctions *funcs = QOpenGLContext::currentContext()->functions();
+    const int width = qMin(2, qMin(rect.width(), rect.height()));
+    const QRect edges[] = {
+        QRect(rect.left(), rect.top(), rect.width(), width),
+        QRect(rect.left(), rect.bottom() - width + 1, rect.width(), width),
+        QRect(rect.left(), rect.top(), width, rect.height()),
+        QRect(rect.right() - width + 1, rect.top(), width, rect.height())
+    };
+    funcs->glEnable(GL_SCISSOR_TEST);
+    funcs->glClearColor(1, 0, 1, 1);
+    for (const QRect &edge : edges) {
+        funcs->glScissor(edge.x(), edge.y(), edge.width(), edge.height());
+        funcs->glClear(GL_COLOR_BUFFER_BIT);
+    }
+    funcs->glDisable(GL_SCISSOR_TEST);
+}
+#endif
+
 QQuickWindowPrivate::QQuickWindowPrivate()
     : contentItem(nullptr)
     , activeFocusItem(nullptr)
@@ -506,6 +590,7 @@ QQuickWindowPrivate::QQuickWindowPrivate()
     , customRenderStage(nullptr)
     , clearColor(Qt::white)
     , clearBeforeRendering(true)
+    , partialUpdates(false)
     , persistentGLContext(true)
     , persistentSceneGraph(true)
     , lastWheelEventAccepted(false)
@@ -516,6 +601,7 @@ QQuickWindowPrivate::QQuickWindowPrivate()
     , renderTarget(nullptr)
     , renderTargetId(0)
     , vaoHelper(nullptr)
+    , partialUpdateFbo(nullptr)
     , incubationController(nullptr)
 {
 #if QT_CONFIG(draganddrop)
@@ -546,6 +632,7 @@ void QQuickWindowPrivate::init(QQuickWindow *c, QQuickRenderControl *control)
     contentItem->setSize(q->size());
 
     customRenderMode = qgetenv("QSG_VISUALIZE");
+    partialUpdates = qEnvironmentVariableIntValue("QSG_PARTIAL_UPDATE") != 0;
     renderControl = control;
     if (renderControl)
         QQuickRenderControlPrivate::get(renderControl)->window = q;
@@ -3517,6 +3604,8 @@ void QQuickWindow::cleanupSceneGraph()
 #if QT_CONFIG(opengl)
     delete d->vaoHelper;
     d->vaoHelper = nullptr;
+    delete d->partialUpdateFbo;
+    d->partialUpdateFbo = nullptr;
 #endif
     if (!d->renderer)
         return;
@@ -4845,6 +4934,67 @@ QSGRendererInterface *QQuickWindow::rendererInterface() const
     return d->context->sceneGraphContext()->rendererInterface(d->context);
 }
 
+/*
+    Returns statistics about the last frame rendered for this window, as a
+    map with the following keys:
+
+    preprocessTime, updateTime, bindingTime and renderTime: time spent in
+    QSGNode::preprocess(), updating the node states, binding the render
+    target and rendering, in nanoseconds.
+
+    opaqueBatches, alphaBatches, mergedBatches, unmergedBatches and
+    culledBatches: the batches of the frame, and those skipped because they
+    were outside the viewport.
+
+    vertexBytesUploaded, indexBytesUploaded, materialChanges and
+    shaderChanges: uploads and state changes.
+
+    rebuild: what had to be rebuilt, "none", "batches", "partial",
+    "renderlists" or "full".
+
+    frameInterval, syncTime, swapTime and renderThreadWindows: the time
+    since the previous frame was swapped, the time spent synchronizing with
+    the GUI thread and swapping, in nanoseconds, and the number of windows
+    rendered by the same render thread.
+
+    The batch, upload and state change counters are only provided by the
+    default OpenGL renderer, and the frame pacing values only by the
+    threaded render loop. Can be called from any thread.
+*/
+QVariantMap QQuickWindowPrivate::rendererStatistics() const
+{
+    QSGRendererStatistics statistics;
+    QQuickWindowFrameTiming timing;
+    {
+        QMutexLocker locker(&rendererStatisticsMutex);
+        statistics = lastFrameStatistics;
+        timing = frameTiming;
+    }
+
+    static const char *rebuildNames[] = { "none", "batches", "partial", "renderlists", "full" };
+
+    QVariantMap map;
+    map.insert(QStringLiteral("preprocessTime"), statistics.preprocessTime);
+    map.insert(QStringLiteral("updateTime"), statistics.updateTime);
+    map.insert(QStringLiteral("bindingTime"), statistics.bindingTime);
+    map.insert(QStringLiteral("renderTime"), statistics.renderTime);
+    map.insert(QStringLiteral("opaqueBatches"), statistics.opaqueBatches);
+    map.insert(QStringLiteral("alphaBatches"), statistics.alphaBatches);
+    map.insert(QStringLiteral("mergedBatches"), statistics.mergedBatches);
+    map.insert(QStringLiteral("unmergedBatches"), statistics.unmergedBatches);
+    map.insert(QStringLiteral("culledBatches"), statistics.culledBatches);
+    map.insert(QStringLiteral("vertexBytesUploaded"), statistics.vertexBytesUploaded);
+    map.insert(QStringLiteral("indexBytesUploaded"), statistics.indexBytesUploaded);
+    map.insert(QStringLiteral("materialChanges"), statistics.materialChanges);
+    map.insert(QStringLiteral("shaderChanges"), statistics.shaderChanges);
+    map.insert(QStringLiteral("rebuild"), QString::fromLatin1(rebuildNames[statistics.rebuild]));
+    map.insert(QStringLiteral("frameInterval"), timing.frameInterval);
+    map.insert(QStringLiteral("syncTime"), timing.syncTime);
+    map.insert(QStringLiteral("swapTime"), timing.swapTime);
+    map.insert(QStringLiteral("renderThreadWindows"), timing.renderThreadWindows);
+    return map;
+}
+
 /*!
     Requests a Qt Quick scenegraph backend for the specified graphics \a api.
     Backends can either be built-in or be installed in form of dynamically
@@ -4977,6 +5127,29 @@ void QQuickWindow::setTextRenderType(QQuickWindow::TextRenderType renderType)
     QQuickWindowPrivate::textRenderType = renderType;
 }
 
+/*
+    Starts generating the distance field glyphs needed to render \a text
+    with \a font on a worker thread, so that the render thread doesn't have
+    to generate them the first time they are shown. Returns immediately;
+    glyphs that aren't ready in time are generated on the render thread as
+    usual. The glyphs are kept for the lifetime of the application.
+*/
+void QQuickWindowPrivate::prewarmDistanceFieldGlyphs(const QFont &font, const QString &text)
+{
+    if (text.isEmpty())
+        return;
+
+    QTextLayout layout(text, font);
+    layout.beginLayout();
+    while (layout.createLine().isValid()) { }
+    layout.endLayout();
+
+    QSGDistanceFieldGlyphStore *store = QSGDistanceFieldGlyphStore::instance();
+    const QList<QGlyphRun> glyphRuns = layout.glyphRuns();
+    for (const QGlyphRun &glyphRun : glyphRuns)
+        store->prewarm(glyphRun.rawFont(), glyphRun.glyphIndexes());
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 QDebug operator<<(QDebug debug, const QQuickWindow *win)
 {
@@ -56,11 +56,13 @@
 #include "qquickevents_p_p.h"
 
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgrenderer_p.h>
 
 #include <QtCore/qthread.h>
 #include <QtCore/qmutex.h>
 #include <QtCore/qwaitcondition.h>
 #include <QtCore/qrunnable.h>
+#include <QtCore/qvariant.h>
 #include <private/qwindow_p.h>
 #include <private/qopengl_p.h>
 #include <qopenglcontext.h>
@@ -71,6 +73,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QFont;
 class QOpenGLVertexArrayObjectHelper;
 class QQuickAnimatorController;
 class QQuickDragGrabber;
@@ -102,6 +105,16 @@ public:
     virtual bool swap() = 0;
 };
 
+// Frame pacing as seen by the render loop, times are in nanoseconds. Only
+// the threaded render loop fills this in.
+struct QQuickWindowFrameTiming
+{
+    qint64 frameInterval = 0;
+    qint64 syncTime = 0;
+    qint64 swapTime = 0;
+    int renderThreadWindows = 0;
+};
+
 class Q_QUICK_PRIVATE_EXPORT QQuickWindowPrivate : public QWindowPrivate
 {
 public:
@@ -250,6 +263,14 @@ public:
     QSGRenderContext *context;
     QSGRenderer *renderer;
     QByteArray customRenderMode; // Default renderer supports "clip", "overdraw", "changes", "batches" and blank.
+                                 // "damage" is handled by renderSceneGraph() for partial updates.
+
+    QVariantMap rendererStatistics() const;
+
+    // Written by the render thread after each frame, read by rendererStatistics()
+    mutable QMutex rendererStatisticsMutex;
+    QSGRendererStatistics lastFrameStatistics;
+    QQuickWindowFrameTiming frameTiming;
 
     QSGRenderLoop *windowManager;
     QQuickRenderControl *renderControl;
@@ -262,6 +283,7 @@ public:
     QColor clearColor;
 
     uint clearBeforeRendering : 1;
+    uint partialUpdates : 1;
 
     uint persistentGLContext : 1;
     uint persistentSceneGraph : 1;
@@ -280,10 +302,18 @@ public:
 
     QOpenGLVertexArrayObjectHelper *vaoHelper;
 
+#if QT_CONFIG(opengl)
+    uint partialUpdateFramebuffer(const QSize &size);
+    void presentPartialUpdate(const QRect &rect);
+#endif
+    // Keeps the previous frame when partialUpdates is set, see QSG_PARTIAL_UPDATE
+    QOpenGLFramebufferObject *partialUpdateFbo;
+
     mutable QQuickWindowIncubationController *incubationController;
 
     static bool defaultAlphaBuffer;
     static QQuickWindow::TextRenderType textRenderType;
+    static void prewarmDistanceFieldGlyphs(const QFont &font, const QString &text);
 
     static bool dragOverThreshold(qreal d, Qt::Axis axis, QMouseEvent *event, int startDragThreshold = -1);
 
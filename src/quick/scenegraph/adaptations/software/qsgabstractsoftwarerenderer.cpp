@@ -45,6 +45,10 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -57,6 +61,10 @@ QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *conte
     , m_background(new QSGSimpleRectNode)
     , m_nodeUpdater(new QSGSoftwareRenderableNodeUpdater(this))
 {
+    m_renderThreadCount = qEnvironmentVariableIsSet("QSG_SOFTWARE_RENDER_THREADS")
+            ? qEnvironmentVariableIntValue("QSG_SOFTWARE_RENDER_THREADS")
+            : QThread::idealThreadCount();
+
     // Setup special background node
     auto backgroundRenderable = new QSGSoftwareRenderableNode(QSGSoftwareRenderableNode::SimpleRect, m_background);
     addNodeMapping(m_background, backgroundRenderable);
@@ -70,6 +78,8 @@ QSGAbstractSoftwareRenderer::~QSGAbstractSoftwareRenderer()
     qDeleteAll(m_nodes);
 
     delete m_nodeUpdater;
+
+    delete m_threadPool;
 }
 
 QSGSoftwareRenderableNode *QSGAbstractSoftwareRenderer::renderableNode(QSGNode *node) const
@@ -80,6 +90,8 @@ QSGSoftwareRenderableNode *QSGAbstractSoftwareRenderer::renderableNode(QSGNode *
 void QSGAbstractSoftwareRenderer::addNodeMapping(QSGNode *node, QSGSoftwareRenderableNode *renderableNode)
 {
     m_nodes.insert(node, renderableNode);
+    // The render list only holds mapped nodes, so it has to pick this one up
+    m_renderListDirty = true;
 }
 
 void QSGAbstractSoftwareRenderer::appendRenderableNode(QSGSoftwareRenderableNode *node)
@@ -100,9 +112,11 @@ void QSGAbstractSoftwareRenderer::nodeChanged(QSGNode *node, QSGNode::DirtyState
         }
         if (state & QSGNode::DirtyNodeAdded) {
             nodeAdded(node);
+            m_renderListDirty = true;
         }
         if (state & QSGNode::DirtyNodeRemoved) {
             nodeRemoved(node);
+            m_renderListDirty = true;
         }
         if (state & QSGNode::DirtyOpacity) {
             nodeOpacityUpdated(node);
@@ -137,8 +151,170 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+namespace {
+
+// Bands thinner than this are not worth a thread of their own
+const int minimumBandHeight = 64;
+// Neither are updates smaller than this
+const int minimumParallelArea = 256 * 256;
+
+struct BandTarget
+{
+    uchar *bits;
+    int bytesPerLine;
+    int bytesPerPixel;
+    QImage::Format format;
+    int devicePixelRatio;
+};
+
+// Glyph nodes fill the font engine's glyph cache while painting, which is
+// shared by all tiles. The per-node caches of the other node types are brought
+// up to date by prepareForPainting() before the tiles are painted.
+bool paintsSharedState(QSGSoftwareRenderableNode::NodeType type)
+{
+    return type == QSGSoftwareRenderableNode::Glyph;
+}
+
+void paintBand(const QVector<QSGSoftwareRenderableNode *> &nodes, QSGSoftwareRenderableNode *background,
+               const BandTarget &target, const QRect &band, QPainter::RenderHints hints, QMutex *mutex)
+{
+    const int dpr = target.devicePixelRatio;
+    // Wrap the band's scanlines of the target image, painting into it paints into the target
+    QImage image(target.bits + band.y() * dpr * target.bytesPerLine + band.x() * dpr * target.bytesPerPixel,
+                 band.width() * dpr, band.height() * dpr, target.bytesPerLine, target.format);
+    image.setDevicePixelRatio(dpr);
+
+    QPainter painter(&image);
+    painter.setRenderHints(hints);
+    for (QSGSoftwareRenderableNode *node : nodes) {
+        if (paintsSharedState(node->type())) {
+            QMutexLocker locker(mutex);
+            node->paintTile(&painter, band, node == background);
+        } else {
+            node->paintTile(&painter, band, node == background);
+        }
+    }
+}
+
+class BandRenderer : public QRunnable
+{
+public:
+    BandRenderer(const QVector<QSGSoftwareRenderableNode *> &nodes, QSGSoftwareRenderableNode *background,
+                 const BandTarget &target, const QRect &band, QPainter::RenderHints hints, QMutex *mutex)
+        : m_nodes(nodes), m_background(background), m_target(target), m_band(band), m_hints(hints), m_mutex(mutex)
+    {
+    }
+
+    void run() override
+    {
+        paintBand(m_nodes, m_background, m_target, m_band, m_hints, m_mutex);
+    }
+
+private:
+    const QVector<QSGSoftwareRenderableNode *> &m_nodes;
+    QSGSoftwareRenderableNode *m_background;
+    BandTarget m_target;
+    QRect m_band;
+    QPainter::RenderHints m_hints;
+    QMutex *m_mutex;
+};
+
+}
+
+QRect QSGAbstractSoftwareRenderer::parallelRenderArea(const QImage *target) const
+{
+    if (m_renderThreadCount < 2 || target->depth() < 8 || target->depth() % 8 != 0)
+        return QRect();
+
+    // Bands are addressed in whole device pixels
+    const qreal dpr = target->devicePixelRatioF();
+    if (!qFuzzyCompare(dpr, qreal(qRound(dpr))))
+        return QRect();
+
+    QRect area;
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes) {
+        // Render nodes paint through the shared active painter
+        if (node->type() == QSGSoftwareRenderableNode::RenderNode && node->isDirty())
+            return QRect();
+        if (node->needsPainting())
+            area |= node->dirtyRegion().boundingRect();
+    }
+
+    const int deviceRatio = qRound(dpr);
+    area &= QRect(0, 0, target->width() / deviceRatio, target->height() / deviceRatio);
+    if (area.width() * area.height() < minimumParallelArea || area.height() < 2 * minimumBandHeight)
+        return QRect();
+
+    return area;
+}
+
+// Paints the render list into target by splitting area into horizontal bands
+// that are painted concurrently, each with its own QPainter. Every band paints
+// the nodes back to front, clipped to the band, so the result is the same as
+// painting the whole list with renderNodes(QPainter *).
+QRegion QSGAbstractSoftwareRenderer::renderNodes(QImage *target, const QRect &area, QPainter::RenderHints hints)
+{
+    Q_ASSERT(!area.isEmpty());
+
+    QVector<QSGSoftwareRenderableNode *> nodes;
+    nodes.reserve(m_renderableNodes.size());
+    for (QSGSoftwareRenderableNode *node : qAsConst(m_renderableNodes)) {
+        if (node->needsPainting())
+            nodes.append(node);
+    }
+    QSGSoftwareRenderableNode *background = m_renderableNodes.isEmpty() ? nullptr : m_renderableNodes.first();
+
+    const int deviceRatio = qRound(target->devicePixelRatioF());
+    for (QSGSoftwareRenderableNode *node : qAsConst(nodes))
+        node->prepareForPainting(deviceRatio);
+
+    if (!m_threadPool) {
+        m_threadPool = new QThreadPool;
+        // The calling thread paints a band too
+        m_threadPool->setMaxThreadCount(m_renderThreadCount - 1);
+    }
+
+    BandTarget bandTarget;
+    bandTarget.bits = target->bits();
+    bandTarget.bytesPerLine = target->bytesPerLine();
+    bandTarget.bytesPerPixel = target->depth() / 8;
+    bandTarget.format = target->format();
+    bandTarget.devicePixelRatio = deviceRatio;
+
+    const int bandCount = qMin(m_renderThreadCount, area.height() / minimumBandHeight);
+    QMutex mutex;
+    QRect firstBand;
+    for (int i = 0; i < bandCount; ++i) {
+        const int top = area.top() + area.height() * i / bandCount;
+        const int bottom = area.top() + area.height() * (i + 1) / bandCount;
+        const QRect band(area.left(), top, area.width(), bottom - top);
+        if (i == 0)
+            firstBand = band;
+        else
+            m_threadPool->start(new BandRenderer(nodes, background, bandTarget, band, hints, &mutex));
+    }
+    paintBand(nodes, background, bandTarget, firstBand, hints, &mutex);
+    m_threadPool->waitForDone();
+
+    QRegion dirtyRegion;
+    for (QSGSoftwareRenderableNode *node : qAsConst(m_renderableNodes))
+        dirtyRegion += node->finishRendering();
+
+    qCDebug(lc2DRender) << "renderNodes" << area << "in" << bandCount << "bands";
+
+    return dirtyRegion;
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
+    // The renderlist only depends on the structure of the tree and on which
+    // nodes are renderable. Frames that only change transforms, opacity,
+    // clips, geometry or materials update the renderable nodes in place and
+    // can keep the previous list.
+    if (!m_renderListDirty)
+        return;
+    m_renderListDirty = false;
+
     // Clear the previous renderlist
     m_renderableNodes.clear();
     // Add the background renderable (always first)
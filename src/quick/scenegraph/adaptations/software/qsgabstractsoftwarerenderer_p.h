@@ -55,9 +55,11 @@
 
 #include <QtCore/QHash>
 #include <QtCore/QLinkedList>
+#include <QtGui/QPainter>
 
 QT_BEGIN_NAMESPACE
 
+class QThreadPool;
 class QSGSimpleRectNode;
 
 class QSGSoftwareRenderableNode;
@@ -79,6 +81,9 @@ public:
 
 protected:
     QRegion renderNodes(QPainter *painter);
+    // only valid after calling optimizeRenderList()
+    QRect parallelRenderArea(const QImage *target) const;
+    QRegion renderNodes(QImage *target, const QRect &area, QPainter::RenderHints hints);
     void buildRenderList();
     QRegion optimizeRenderList();
 
@@ -99,6 +104,7 @@ private:
 
     QHash<QSGNode*, QSGSoftwareRenderableNode*> m_nodes;
     QLinkedList<QSGSoftwareRenderableNode*> m_renderableNodes;
+    bool m_renderListDirty = true;
 
     QSGSimpleRectNode *m_background;
 
@@ -107,6 +113,9 @@ private:
     bool m_isOpaque = false;
 
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
+
+    int m_renderThreadCount;
+    QThreadPool *m_threadPool = nullptr;
 };
 
 QT_END_NAMESPACE
@@ -328,11 +328,19 @@ QSGSoftwareInternalImageNode::QSGSoftwareInternalImageNode()
     , m_tileHorizontal(false)
     , m_tileVertical(false)
     , m_cachedMirroredPixmapIsDirty(false)
+    , m_cachedScaledImageCost(0)
+    , m_requestedScaledImageFrame(0)
+    , m_frame(0)
 {
     setMaterial((QSGMaterial*)1);
     setGeometry((QSGGeometry*)1);
 }
 
+QSGSoftwareInternalImageNode::~QSGSoftwareInternalImageNode()
+{
+    releaseScaledImage();
+}
+
 
 void QSGSoftwareInternalImageNode::setTargetRect(const QRectF &rect)
 {
@@ -461,6 +469,12 @@ static Qt::TileRule getTileRule(qreal factor)
 }
 
 
+// Called once per frame before the node is painted, possibly in several tiles
+void QSGSoftwareInternalImageNode::beginFrame()
+{
+    ++m_frame;
+}
+
 void QSGSoftwareInternalImageNode::paint(QPainter *painter)
 {
     painter->setRenderHint(QPainter::SmoothPixmapTransform, m_smooth);
@@ -481,8 +495,13 @@ void QSGSoftwareInternalImageNode::paint(QPainter *painter)
         painter->save();
         qreal sx = m_targetRect.width()/(m_subSourceRect.width()*pm.width());
         qreal sy = m_targetRect.height()/(m_subSourceRect.height()*pm.height());
-        QMatrix transform(sx, 0, 0, sy, 0, 0);
-        painter->setMatrix(transform, true);
+        // Unscaled tiles stay on the raster engine's fast tiled blit
+        if (!qFuzzyCompare(sx, qreal(1)) || !qFuzzyCompare(sy, qreal(1))) {
+            QMatrix transform(sx, 0, 0, sy, 0, 0);
+            painter->setMatrix(transform, true);
+        } else {
+            sx = sy = 1;
+        }
         painter->drawTiledPixmap(QRectF(m_targetRect.x()/sx, m_targetRect.y()/sy, m_targetRect.width()/sx, m_targetRect.height()/sy),
                                  pm,
                                  QPointF(m_subSourceRect.left()*pm.width(), m_subSourceRect.top()*pm.height()));
@@ -490,10 +509,124 @@ void QSGSoftwareInternalImageNode::paint(QPainter *painter)
     } else {
         QRectF sr(m_subSourceRect.left()*pm.width(), m_subSourceRect.top()*pm.height(),
                   m_subSourceRect.width()*pm.width(), m_subSourceRect.height()*pm.height());
-        painter->drawPixmap(m_targetRect, pm, sr);
+        if (!drawScaledPixmap(painter, pm, sr))
+            painter->drawPixmap(m_targetRect, pm, sr);
     }
 }
 
+static inline bool isPixelAligned(const QRectF &rect)
+{
+    const qreal epsilon = 1.0 / 64;
+    return qAbs(rect.left() - qRound(rect.left())) < epsilon
+            && qAbs(rect.top() - qRound(rect.top())) < epsilon
+            && qAbs(rect.right() - qRound(rect.right())) < epsilon
+            && qAbs(rect.bottom() - qRound(rect.bottom())) < epsilon;
+}
+
+static inline QRect roundedRect(const QRectF &rect)
+{
+    const int left = qRound(rect.left());
+    const int top = qRound(rect.top());
+    return QRect(left, top, qRound(rect.right()) - left, qRound(rect.bottom()) - top);
+}
+
+// Upper bound for the memory held by the scaled images of all image nodes
+static const int maximumScaledImageMemory = 16 * 1024 * 1024;
+static QBasicAtomicInt scaledImageMemory = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static bool reserveScaledImageMemory(int cost)
+{
+    if (scaledImageMemory.fetchAndAddRelaxed(cost) + cost <= maximumScaledImageMemory)
+        return true;
+    scaledImageMemory.fetchAndAddRelaxed(-cost);
+    return false;
+}
+
+/*
+    Smoothly scaled pixmaps go through the raster engine's generic bilinear
+    span functions on every frame. When the image lands on whole device
+    pixels, scale it once with QImage's vectorized smooth scaling and then
+    blit the result, which only needs the SSE2/NEON blend functions.
+
+    An image whose size is animated would be scaled again on every frame,
+    which is slower than painting it directly. The scaled image is therefore
+    only created when the same scaling was already requested in an earlier
+    frame, and only while all nodes together stay within the memory budget.
+*/
+bool QSGSoftwareInternalImageNode::drawScaledPixmap(QPainter *painter, const QPixmap &pm, const QRectF &sourceRect)
+{
+    // Layers are repainted in place, so their cache key does not change with their contents
+    if (!m_smooth || m_textureIsLayer || pm.isNull())
+        return false;
+
+    const QTransform deviceTransform = painter->deviceTransform();
+    if (deviceTransform.type() > QTransform::TxScale || deviceTransform.m11() < 0 || deviceTransform.m22() < 0)
+        return false;
+
+    const QRectF deviceRect = deviceTransform.mapRect(m_targetRect);
+    if (!isPixelAligned(deviceRect) || !isPixelAligned(sourceRect))
+        return false;
+
+    const QRect targetRect = roundedRect(deviceRect);
+    const QRect sr = roundedRect(sourceRect);
+    // Nothing to scale, the plain blit is already fast
+    if (targetRect.isEmpty() || sr.isEmpty() || targetRect.size() == sr.size())
+        return false;
+
+    ScaledImageKey key;
+    key.cacheKey = pm.cacheKey();
+    key.sourceRect = sourceRect;
+    key.size = targetRect.size();
+    key.devicePixelRatio = painter->device()->devicePixelRatioF();
+
+    QImage image;
+    {
+        QMutexLocker locker(&m_cachedScaledImageMutex);
+        if (m_cachedScaledImage.isNull() || m_cachedScaledImageKey != key) {
+            if (m_requestedScaledImageKey != key) {
+                releaseScaledImage();
+                m_requestedScaledImageKey = key;
+                m_requestedScaledImageFrame = m_frame;
+                return false;
+            }
+            // Other tiles of the frame that first requested it
+            if (m_requestedScaledImageFrame == m_frame)
+                return false;
+
+            releaseScaledImage();
+            const qint64 cost = qint64(targetRect.width()) * targetRect.height() * 4;
+            if (cost > maximumScaledImageMemory || !reserveScaledImageMemory(int(cost)))
+                return false;
+
+            QImage source = pm.toImage();
+            if (sr != source.rect())
+                source = source.copy(sr);
+            m_cachedScaledImage = source.scaled(targetRect.size(), Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+            m_cachedScaledImage.setDevicePixelRatio(key.devicePixelRatio);
+            m_cachedScaledImageKey = key;
+            m_cachedScaledImageCost = int(cost);
+        }
+        image = m_cachedScaledImage;
+    }
+
+    // The clip was set in world coordinates already and is not affected by this
+    painter->save();
+    painter->setWorldTransform(QTransform());
+    painter->drawImage(QPointF(targetRect.topLeft()) / key.devicePixelRatio, image);
+    painter->restore();
+    return true;
+}
+
+void QSGSoftwareInternalImageNode::releaseScaledImage()
+{
+    if (m_cachedScaledImage.isNull())
+        return;
+    m_cachedScaledImage = QImage();
+    m_cachedScaledImageKey = ScaledImageKey();
+    scaledImageMemory.fetchAndAddRelaxed(-m_cachedScaledImageCost);
+    m_cachedScaledImageCost = 0;
+}
+
 QRectF QSGSoftwareInternalImageNode::rect() const
 {
     return m_targetRect;
@@ -53,6 +53,7 @@
 
 #include <private/qsgadaptationlayer_p.h>
 #include <private/qsgtexturematerial_p.h>
+#include <QtCore/QMutex>
 
 QT_BEGIN_NAMESPACE
 
@@ -105,6 +106,7 @@ class QSGSoftwareInternalImageNode : public QSGInternalImageNode
 {
 public:
     QSGSoftwareInternalImageNode();
+    ~QSGSoftwareInternalImageNode();
 
     void setTargetRect(const QRectF &rect) override;
     void setInnerTargetRect(const QRectF &rect) override;
@@ -120,12 +122,30 @@ public:
 
     void preprocess() override;
 
+    void beginFrame();
     void paint(QPainter *painter);
 
     QRectF rect() const;
 
     const QPixmap &pixmap() const;
 private:
+    struct ScaledImageKey
+    {
+        qint64 cacheKey = 0;
+        QRectF sourceRect;
+        QSize size;
+        qreal devicePixelRatio = 0;
+
+        bool operator==(const ScaledImageKey &other) const
+        {
+            return cacheKey == other.cacheKey && sourceRect == other.sourceRect && size == other.size
+                    && qFuzzyCompare(devicePixelRatio, other.devicePixelRatio);
+        }
+        bool operator!=(const ScaledImageKey &other) const { return !operator==(other); }
+    };
+
+    bool drawScaledPixmap(QPainter *painter, const QPixmap &pm, const QRectF &sourceRect);
+    void releaseScaledImage();
 
     QRectF m_targetRect;
     QRectF m_innerTargetRect;
@@ -141,6 +161,16 @@ private:
     bool m_tileHorizontal;
     bool m_tileVertical;
     bool m_cachedMirroredPixmapIsDirty;
+
+    // Guards the scaled image, which is updated while painting
+    QMutex m_cachedScaledImageMutex;
+    QImage m_cachedScaledImage;
+    ScaledImageKey m_cachedScaledImageKey;
+    int m_cachedScaledImageCost;
+    // The image is only scaled once the same scaling is requested in a later frame
+    ScaledImageKey m_requestedScaledImageKey;
+    int m_requestedScaledImageFrame;
+    int m_frame;
 };
 
 QT_END_NAMESPACE
@@ -223,14 +223,19 @@ void QSGSoftwareInternalRectangleNode::update()
     }
 }
 
+void QSGSoftwareInternalRectangleNode::setDevicePixelRatio(qreal ratio)
+{
+    if (!qFuzzyCompare(ratio, m_devicePixelRatio)) {
+        m_devicePixelRatio = ratio;
+        generateCornerPixmap();
+    }
+}
+
 void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 {
     //We can only check for a device pixel ratio change when we know what
     //paint device is being used.
-    if (!qFuzzyCompare(painter->device()->devicePixelRatioF(), m_devicePixelRatio)) {
-        m_devicePixelRatio = painter->device()->devicePixelRatioF();
-        generateCornerPixmap();
-    }
+    setDevicePixelRatio(painter->device()->devicePixelRatioF());
 
     if (painter->transform().isRotating()) {
         //Rotated rectangles lose the benefits of direct rendering, and have poor rendering
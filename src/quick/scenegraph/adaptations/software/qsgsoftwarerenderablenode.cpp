@@ -248,13 +248,7 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     Q_ASSERT(painter);
 
     // Check for don't paint conditions
-    if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
-    } else {
+    if (m_nodeType == RenderNode) {
         if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
             m_isDirty = false;
             m_dirtyRegion = QRegion();
@@ -286,16 +280,84 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         }
     }
 
+    if (needsPainting()) {
+        prepareForPainting(painter->device()->devicePixelRatioF());
+        paint(painter, m_dirtyRegion, QPoint(), forceOpaquePainting);
+    }
+
+    return finishRendering();
+}
+
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    return m_nodeType != RenderNode && m_isDirty && !qFuzzyIsNull(m_opacity) && !m_dirtyRegion.isEmpty();
+}
+
+// Called once per frame before the node is painted. Updates the caches paint()
+// would otherwise update on the fly, so that several tiles of the node can be
+// painted concurrently afterwards.
+void QSGSoftwareRenderableNode::prepareForPainting(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Image:
+        m_handle.imageNode->beginFrame();
+        break;
+    case QSGSoftwareRenderableNode::Rectangle:
+        m_handle.rectangleNode->setDevicePixelRatio(devicePixelRatio);
+        break;
+    case QSGSoftwareRenderableNode::SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->updateCachedMirroredPixmap();
+        break;
+    default:
+        break;
+    }
+}
+
+// Paints the part of the dirty region that falls into tile. The painter's
+// device is expected to cover exactly the tile, so world coordinates are
+// shifted by its top left corner. The dirty state is left untouched so that
+// several tiles can be painted before finishRendering() is called.
+void QSGSoftwareRenderableNode::paintTile(QPainter *painter, const QRect &tile, bool forceOpaquePainting)
+{
+    Q_ASSERT(painter);
+    Q_ASSERT(m_nodeType != RenderNode);
+
+    const QRegion clip = m_dirtyRegion.intersected(tile);
+    if (!clip.isEmpty())
+        paint(painter, clip, tile.topLeft(), forceOpaquePainting);
+}
+
+QRegion QSGSoftwareRenderableNode::finishRendering()
+{
+    if (!needsPainting()) {
+        m_isDirty = false;
+        m_dirtyRegion = QRegion();
+        return QRegion();
+    }
+
+    QRegion areaToBeFlushed = m_dirtyRegion;
+    m_previousDirtyRegion = QRegion(m_boundingRectMax);
+    m_isDirty = false;
+    m_dirtyRegion = QRegion();
+
+    return areaToBeFlushed;
+}
+
+void QSGSoftwareRenderableNode::paint(QPainter *painter, const QRegion &clip, const QPoint &offset, bool forceOpaquePainting)
+{
     painter->save();
     painter->setOpacity(m_opacity);
 
-    // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
-    // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    // Set clipRegion to clip, which is m_dirtyRegion or a tile of it (in world coordinates, so must be
+    // done before the setTransform below) as m_dirtyRegion already accounts for clipRegion
+    painter->setClipRegion(clip.translated(-offset), Qt::ReplaceClip);
     if (m_clipRegion.rectCount() > 1)
-        painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
+        painter->setClipRegion(m_clipRegion.translated(-offset), Qt::IntersectClip);
 
-    painter->setTransform(m_transform, false); //precalculated worldTransform
+    QTransform transform = m_transform;
+    if (!offset.isNull())
+        transform *= QTransform::fromTranslate(-offset.x(), -offset.y());
+    painter->setTransform(transform, false); //precalculated worldTransform
     if (forceOpaquePainting || m_isOpaque)
         painter->setCompositionMode(QPainter::CompositionMode_Source);
 
@@ -346,13 +408,6 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     }
 
     painter->restore();
-
-    QRegion areaToBeFlushed = m_dirtyRegion;
-    m_previousDirtyRegion = QRegion(m_boundingRectMax);
-    m_isDirty = false;
-    m_dirtyRegion = QRegion();
-
-    return areaToBeFlushed;
 }
 
 bool QSGSoftwareRenderableNode::isDirtyRegionEmpty() const
@@ -98,6 +98,10 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+    bool needsPainting() const;
+    void prepareForPainting(qreal devicePixelRatio);
+    void paintTile(QPainter *painter, const QRect &tile, bool forceOpaquePainting = false);
+    QRegion finishRendering();
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
@@ -122,6 +126,8 @@ public:
     QRegion dirtyRegion() const;
 
 private:
+    void paint(QPainter *painter, const QRegion &clip, const QPoint &offset, bool forceOpaquePainting);
+
     union RenderableNodeHandle {
         QSGSimpleRectNode *simpleRectNode;
         QSGSimpleTextureNode *simpleTextureNode;
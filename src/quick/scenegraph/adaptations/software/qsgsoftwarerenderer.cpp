@@ -146,21 +146,32 @@ void QSGSoftwareRenderer::render()
         m_paintDevice = m_backingStore->paintDevice();
     }
 
-    QPainter painter(m_paintDevice);
-    painter.setRenderHint(QPainter::Antialiasing);
-    auto rc = static_cast<QSGSoftwareRenderContext *>(context());
-    QPainter *prevPainter = rc->m_activePainter;
-    rc->m_activePainter = &painter;
-
-    // Render the contents Renderlist
-    m_flushRegion = renderNodes(&painter);
-    qint64 renderTime = renderTimer.elapsed();
+    // Large updates of raster images are split into bands painted by several threads
+    QImage *image = m_paintDevice->devType() == QInternal::Image ? static_cast<QImage *>(m_paintDevice) : nullptr;
+    const QRect parallelArea = image ? parallelRenderArea(image) : QRect();
+
+    qint64 renderTime;
+    if (!parallelArea.isEmpty()) {
+        m_flushRegion = renderNodes(image, parallelArea, QPainter::Antialiasing);
+        renderTime = renderTimer.elapsed();
+    } else {
+        QPainter painter(m_paintDevice);
+        painter.setRenderHint(QPainter::Antialiasing);
+        auto rc = static_cast<QSGSoftwareRenderContext *>(context());
+        QPainter *prevPainter = rc->m_activePainter;
+        rc->m_activePainter = &painter;
+
+        // Render the contents Renderlist
+        m_flushRegion = renderNodes(&painter);
+        renderTime = renderTimer.elapsed();
+
+        painter.end();
+        rc->m_activePainter = prevPainter;
+    }
 
-    painter.end();
     if (m_backingStore != nullptr)
         m_backingStore->endPaint();
 
-    rc->m_activePainter = prevPainter;
     qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime;
 }
 
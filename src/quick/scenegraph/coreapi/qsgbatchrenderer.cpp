@@ -47,6 +47,9 @@
 #include <qmath.h>
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtCore/QtNumeric>
 
 #include <QtGui/QGuiApplication>
@@ -57,6 +60,8 @@
 
 #include <private/qnumeric_p.h>
 #include <private/qquickprofiler_p.h>
+#include <private/qsimd_p.h>
+#include "qsgmaterial_p.h"
 #include "qsgmaterialshader_p.h"
 
 #include <algorithm>
@@ -86,6 +91,7 @@ DECLARE_DEBUG_VAR(dump)
 DECLARE_DEBUG_VAR(noalpha)
 DECLARE_DEBUG_VAR(noopaque)
 DECLARE_DEBUG_VAR(noclip)
+DECLARE_DEBUG_VAR(nocull)
 #undef DECLARE_DEBUG_VAR
 
 static QElapsedTimer qsg_renderer_timer;
@@ -644,6 +650,7 @@ bool Batch::geometryWasChanged(QSGGeometryNode *gn)
         e = e->nextInBatch;
     if (!e || e->node->geometry()->attributes() == gn->geometry()->attributes()) {
         needsUpload = true;
+        partialUpload = false;
         return true;
     } else {
         return false;
@@ -670,6 +677,37 @@ void Batch::cleanupRemovedElements()
     }
 }
 
+/*
+ * Computes the union of the bounds of all elements in this batch, relative to
+ * the batch root. The result is only used for viewport culling, so batches
+ * with elements that have no usable bounds, or whose material may move the
+ * vertices in the vertex shader, are simply marked as not cullable.
+ * Element bounds are cached, so this is cheap unless the elements changed.
+ */
+void Batch::computeBounds()
+{
+    cullable = !isRenderNode;
+    bounds.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (Element *e = first; e && cullable; e = e->nextInBatch) {
+        if (e->removed)
+            continue;
+        // The vertex shader may put the vertices anywhere
+        if (!QSGMaterialPrivate::hasFlag(e->node->activeMaterial(), QSGMaterialPrivate::NoVertexDisplacement)
+                || !QMatrix4x4_Accessor::is2DSafe(*e->node->matrix())) {
+            cullable = false;
+            break;
+        }
+        e->ensureBoundsValid();
+        if (e->bounds.isOutsideFloatRange()) {
+            cullable = false;
+            break;
+        }
+        bounds |= e->bounds;
+    }
+    if (bounds.tl.x > bounds.br.x)
+        cullable = false;
+}
+
 /*
  * Iterates through all geometry nodes in this batch and unsets their batch,
  * thus forcing them to be rebuilt
@@ -684,6 +722,7 @@ void Batch::invalidate()
     root = nullptr;
     while (e) {
         e->batch = nullptr;
+        e->needsVertexUpload = false;
         Element *n = e->nextInBatch;
         e->nextInBatch = nullptr;
         e = n;
@@ -774,14 +813,21 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_clipMatrixId(0)
     , m_currentClip(nullptr)
     , m_currentClipType(NoClip)
+    , m_damagedElements(64)
+    , m_fullDamage(false)
+    , m_damageValid(false)
+    , m_scissorToDamage(false)
     , m_vertexUploadPool(256)
     , m_indexUploadPool(64)
     , m_vao(nullptr)
+    , m_uploadThreadPool(nullptr)
     , m_visualizeMode(VisualizeNothing)
 {
     initializeOpenGLFunctions();
     setNodeUpdater(new Updater(this));
 
+    m_removedDamage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
     m_shaderManager = ctx->findChild<ShaderManager *>(QStringLiteral("__qt_ShaderManager"), Qt::FindDirectChildrenOnly);
     if (!m_shaderManager) {
         m_shaderManager = new ShaderManager(ctx);
@@ -801,10 +847,12 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
 
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
+    m_uploadThreadCount = qMax(1, qt_sg_envInt("QSG_RENDERER_UPLOAD_THREADS", QThread::idealThreadCount()));
+    m_cullBatches = !debug_nocull();
 
     if (Q_UNLIKELY(debug_build() || debug_render())) {
-        qDebug("Batch thresholds: nodes: %d vertices: %d",
-               m_batchNodeThreshold, m_batchVertexThreshold);
+        qDebug("Batch thresholds: nodes: %d vertices: %d, upload threads: %d",
+               m_batchNodeThreshold, m_batchVertexThreshold, m_uploadThreadCount);
         qDebug("Using buffer strategy: %s",
                (m_bufferStrategy == GL_STATIC_DRAW
                 ? "static" : (m_bufferStrategy == GL_DYNAMIC_DRAW ? "dynamic" : "stream")));
@@ -842,6 +890,8 @@ static void qsg_wipeBatch(Batch *batch, QOpenGLFunctions *funcs, bool separateIn
 
 Renderer::~Renderer()
 {
+    delete m_uploadThreadPool;
+
     if (QOpenGLContext::currentContext()) {
         // Clean up batches and buffers
         const bool separateIndexBuffer = m_context->separateIndexBuffer();
@@ -1002,7 +1052,11 @@ void Renderer::nodeWasTransformed(Node *node, int *vertexCount)
                 if (!e->batch->isOpaque) {
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
                 } else if (e->batch->merged) {
+                    // Only the vertices move, unless something else already needs a full upload
+                    if (!e->batch->needsUpload)
+                        e->batch->partialUpload = true;
                     e->batch->needsUpload = true;
+                    e->needsVertexUpload = true;
                 }
             }
         }
@@ -1075,6 +1129,7 @@ void Renderer::nodeWasRemoved(Node *node)
             }
             if (e->batch) {
                 e->batch->needsUpload = true;
+                e->batch->partialUpload = false;
             }
 
         }
@@ -1198,6 +1253,13 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
 
     shadowNode->dirtyState |= state;
 
+    if (partialUpdatesEnabled() && !m_fullDamage) {
+        if (state & QSGNode::DirtyNodeRemoved)
+            damageRemovedSubtree(shadowNode);
+        else
+            damageSubtree(shadowNode);
+    }
+
     if (state & QSGNode::DirtyMatrix && !shadowNode->isBatchRoot) {
         Q_ASSERT(node->type() == QSGNode::TransformNodeType);
         if (node->m_subtreeRenderableCount > m_batchNodeThreshold) {
@@ -1222,6 +1284,7 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
                 } else {
                     b->needsUpload = true;
+                    b->partialUpload = false;
                 }
             }
         }
@@ -1270,6 +1333,40 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
     QSGRenderer::nodeChanged(node, state);
 }
 
+/*
+ * Collects the elements in the subtree of \a node, as their area on screen
+ * or their content may have changed. Both the area they covered when they
+ * were last rendered and their current area are repainted.
+ */
+void Renderer::damageSubtree(Node *node)
+{
+    if (node->type() == QSGNode::GeometryNodeType) {
+        Element *e = node->element();
+        if (e && !e->damaged) {
+            e->damaged = true;
+            m_damagedElements.add(e);
+        }
+    }
+
+    SHADOWNODE_TRAVERSE(node)
+        damageSubtree(child);
+}
+
+void Renderer::damageRemovedSubtree(Node *node)
+{
+    if (node->type() == QSGNode::GeometryNodeType) {
+        Element *e = node->element();
+        if (e && e->damageBoundsValid)
+            m_removedDamage |= e->damageBounds;
+    } else if (node->type() == QSGNode::RenderNodeType) {
+        // We don't know what it covered
+        m_fullDamage = true;
+    }
+
+    SHADOWNODE_TRAVERSE(node)
+        damageRemovedSubtree(child);
+}
+
 /*
  * Traverses the tree and builds two list of geometry nodes. One for
  * the opaque and one for the translucent. These are populated
@@ -1700,32 +1797,224 @@ static inline int qsg_fixIndexCount(int iCount, GLenum drawMode) {
  * iBase: The starting index for this element in the batch
  */
 
-void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount)
+/*
+ * Transforms the 2D float position at the start of each of the vCount
+ * vertices at vdata in place. This is the reference for the vectorized
+ * qsg_transformPositions().
+ */
+void qsg_transformPositionsScalar(char *vdata, int vCount, int vSize, const QMatrix4x4 &localx)
 {
-    if (Q_UNLIKELY(debug_upload())) qDebug() << "  - uploading element:" << e << e->node << (void *) *vertexData << (qintptr) (*zData - *vertexData) << (qintptr) (*indexData - *vertexData);
-    QSGGeometry *g = e->node->geometry();
-
-    const QMatrix4x4 &localx = *e->node->matrix();
-
-    const int vCount = g->vertexCount();
-    const int vSize = g->sizeOfVertex();
-    memcpy(*vertexData, g->vertexData(), vSize * vCount);
+    const float *m = localx.constData();
+    const int flagBits = ((const QMatrix4x4_Accessor &) localx).flagBits;
+    if (flagBits == 0)
+        return;
 
-    // apply vertex transform..
-    char *vdata = *vertexData + vaOffset;
-    if (((const QMatrix4x4_Accessor &) localx).flagBits == 1) {
+    if (flagBits == 1) {
         for (int i=0; i<vCount; ++i) {
             Pt *p = (Pt *) vdata;
-            p->x += ((const QMatrix4x4_Accessor &) localx).m[3][0];
-            p->y += ((const QMatrix4x4_Accessor &) localx).m[3][1];
+            p->x += m[12];
+            p->y += m[13];
             vdata += vSize;
         }
-    } else if (((const QMatrix4x4_Accessor &) localx).flagBits > 1) {
+    } else {
         for (int i=0; i<vCount; ++i) {
             ((Pt *) vdata)->map(localx);
             vdata += vSize;
         }
     }
+}
+
+void qsg_transformPositions(char *vdata, int vCount, int vSize, const QMatrix4x4 &localx)
+{
+    const float *m = localx.constData();
+    const int flagBits = ((const QMatrix4x4_Accessor &) localx).flagBits;
+    if (flagBits == 0)
+        return;
+
+#if defined(__SSE2__)
+    // Two vertices per iteration; the positions are loaded as (x0, y0, x1, y1).
+    // The operations are done in the same order as Pt::map() so the result
+    // does not depend on which path was taken.
+    const __m128 c3 = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+    int i = 0;
+    if (flagBits == 1) {
+        for (; i + 1 < vCount; i += 2) {
+            __m128d v = _mm_load_sd((const double *) vdata);
+            v = _mm_loadh_pd(v, (const double *) (vdata + vSize));
+            const __m128d r = _mm_castps_pd(_mm_add_ps(_mm_castpd_ps(v), c3));
+            _mm_store_sd((double *) vdata, r);
+            _mm_storeh_pd((double *) (vdata + vSize), r);
+            vdata += 2 * vSize;
+        }
+    } else {
+        const __m128 c0 = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+        const __m128 c1 = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+        for (; i + 1 < vCount; i += 2) {
+            __m128d v = _mm_load_sd((const double *) vdata);
+            v = _mm_loadh_pd(v, (const double *) (vdata + vSize));
+            const __m128 xy = _mm_castpd_ps(v);
+            const __m128 xx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 yy = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, c0), _mm_mul_ps(yy, c1)), c3);
+            const __m128d r = _mm_castps_pd(p);
+            _mm_store_sd((double *) vdata, r);
+            _mm_storeh_pd((double *) (vdata + vSize), r);
+            vdata += 2 * vSize;
+        }
+    }
+    if (i < vCount) {
+        // odd vertex count, the last one is done on its own
+        if (flagBits == 1) {
+            ((Pt *) vdata)->x += m[12];
+            ((Pt *) vdata)->y += m[13];
+        } else {
+            ((Pt *) vdata)->map(localx);
+        }
+    }
+#elif defined(__ARM_NEON)
+    const float32x2_t c3 = { m[12], m[13] };
+    if (flagBits == 1) {
+        for (int i=0; i<vCount; ++i) {
+            float *p = (float *) vdata;
+            vst1_f32(p, vadd_f32(vld1_f32(p), c3));
+            vdata += vSize;
+        }
+    } else {
+        const float32x2_t c0 = { m[0], m[1] };
+        const float32x2_t c1 = { m[4], m[5] };
+        for (int i=0; i<vCount; ++i) {
+            float *p = (float *) vdata;
+            const float32x2_t r = vadd_f32(vmul_n_f32(c0, p[0]), vmul_n_f32(c1, p[1]));
+            vst1_f32(p, vadd_f32(r, c3));
+            vdata += vSize;
+        }
+    }
+#else
+    Q_UNUSED(m);
+    qsg_transformPositionsScalar(vdata, vCount, vSize, localx);
+#endif
+}
+
+/*
+ * Copies the vertices of e to vertexData, transformed into the coordinate
+ * system of the batch root.
+ */
+static void qsg_copyMergedVertices(Element *e, int vaOffset, char *vertexData)
+{
+    QSGGeometry *g = e->node->geometry();
+
+    const int vCount = g->vertexCount();
+    const int vSize = g->sizeOfVertex();
+    memcpy(vertexData, g->vertexData(), vSize * vCount);
+
+    // apply vertex transform..
+    qsg_transformPositions(vertexData + vaOffset, vCount, vSize, *e->node->matrix());
+}
+
+/*
+ * Copies and transforms the vertices of the elements from \a first up to, but
+ * not including, \a end. The vertices of merged elements are laid out back to
+ * back in the vertex buffer, so \a vertexData is where \a first's go.
+ */
+static void qsg_copyMergedVertexRange(Element *first, Element *end, int vaOffset, char *vertexData)
+{
+    for (Element *e = first; e != end; e = e->nextInBatch) {
+        qsg_copyMergedVertices(e, vaOffset, vertexData);
+        const QSGGeometry *g = e->node->geometry();
+        vertexData += g->vertexCount() * g->sizeOfVertex();
+    }
+}
+
+namespace {
+
+class MergedVertexCopier : public QRunnable
+{
+public:
+    MergedVertexCopier(Element *first, Element *end, int vaOffset, char *vertexData)
+        : m_first(first)
+        , m_end(end)
+        , m_vaOffset(vaOffset)
+        , m_vertexData(vertexData)
+    {
+    }
+
+    void run() override
+    {
+        qsg_copyMergedVertexRange(m_first, m_end, m_vaOffset, m_vertexData);
+    }
+
+private:
+    Element *m_first;
+    Element *m_end;
+    int m_vaOffset;
+    char *m_vertexData;
+};
+
+}
+
+/*
+ * Below this many vertices, the cost of handing the work to other threads
+ * outweighs the gain of copying in parallel.
+ */
+static const int qsg_minimumParallelVertexCount = 16384;
+
+bool Renderer::copiesMergedVerticesInParallel(const Batch *b) const
+{
+    return m_uploadThreadCount > 1 && b->vertexCount >= qsg_minimumParallelVertexCount;
+}
+
+/*
+ * Copies and transforms the vertices of all elements in the merged batch \a b
+ * into its mapped vertex buffer. The elements are split into ranges of roughly
+ * the same number of vertices, and all but the first range are handed to the
+ * upload thread pool while the calling thread does the first one itself.
+ *
+ * Only the geometry and the matrices of the nodes are read, and the ranges
+ * are written to disjoint parts of the buffer, so the ranges are independent.
+ */
+void Renderer::copyMergedVerticesInParallel(Batch *b)
+{
+    if (!m_uploadThreadPool) {
+        m_uploadThreadPool = new QThreadPool;
+        m_uploadThreadPool->setMaxThreadCount(m_uploadThreadCount - 1);
+    }
+
+    const int verticesPerRange = b->vertexCount / m_uploadThreadCount + 1;
+
+    Element *first = b->first;
+    char *rangeData = b->vbo.data;
+    char *vertexData = rangeData;
+    Element *firstRangeEnd = nullptr;
+    int verticesInRange = 0;
+    for (Element *e = b->first; e; e = e->nextInBatch) {
+        const QSGGeometry *g = e->node->geometry();
+        verticesInRange += g->vertexCount();
+        vertexData += g->vertexCount() * g->sizeOfVertex();
+        if (verticesInRange < verticesPerRange && e->nextInBatch)
+            continue;
+
+        if (!firstRangeEnd)
+            firstRangeEnd = e->nextInBatch;
+        else
+            m_uploadThreadPool->start(new MergedVertexCopier(first, e->nextInBatch, b->positionAttribute, rangeData));
+        first = e->nextInBatch;
+        rangeData = vertexData;
+        verticesInRange = 0;
+    }
+
+    qsg_copyMergedVertexRange(b->first, firstRangeEnd, b->positionAttribute, b->vbo.data);
+    m_uploadThreadPool->waitForDone();
+}
+
+void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount, bool copyVertices)
+{
+    if (Q_UNLIKELY(debug_upload())) qDebug() << "  - uploading element:" << e << e->node << (void *) *vertexData << (qintptr) (*zData - *vertexData) << (qintptr) (*indexData - *vertexData);
+    QSGGeometry *g = e->node->geometry();
+
+    const int vCount = g->vertexCount();
+    const int vSize = g->sizeOfVertex();
+    if (copyVertices)
+        qsg_copyMergedVertices(e, vaOffset, *vertexData);
 
     if (m_useDepthBuffer) {
         float *vzorder = (float *) *zData;
@@ -1768,6 +2057,50 @@ void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData,
     *indexCount += iCount;
 }
 
+/*
+ * Uploads the vertices of the elements that were transformed since the last
+ * upload of this merged batch. Their vertex and index counts, order and z
+ * are unchanged, so the rest of the buffer stays valid. Runs of adjacent
+ * elements are replaced with a single glBufferSubData() call.
+ */
+void Renderer::uploadTransformedElements(Batch *b)
+{
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "uploading transformed elements only...";
+
+    const int vSize = b->first->node->geometry()->sizeOfVertex();
+    glBindBuffer(GL_ARRAY_BUFFER, b->vbo.id);
+
+    Element *e = b->first;
+    int offset = 0;
+    while (e) {
+        if (!e->needsVertexUpload) {
+            offset += e->node->geometry()->vertexCount() * vSize;
+            e = e->nextInBatch;
+            continue;
+        }
+
+        Element *end = e;
+        int size = 0;
+        while (end && end->needsVertexUpload) {
+            size += end->node->geometry()->vertexCount() * vSize;
+            end = end->nextInBatch;
+        }
+
+        if (size > m_vertexUploadPool.size())
+            m_vertexUploadPool.resize(size);
+        char *vertexData = m_vertexUploadPool.data();
+        for (; e != end; e = e->nextInBatch) {
+            qsg_copyMergedVertices(e, b->positionAttribute, vertexData);
+            vertexData += e->node->geometry()->vertexCount() * vSize;
+            e->needsVertexUpload = false;
+        }
+
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, m_vertexUploadPool.data());
+        m_statistics.vertexBytesUploaded += size;
+        offset += size;
+    }
+}
+
 static QMatrix4x4 qsg_matrixForRoot(Node *node)
 {
     if (node->type() == QSGNode::TransformNodeType)
@@ -1777,6 +2110,155 @@ static QMatrix4x4 qsg_matrixForRoot(Node *node)
     return *c->matrix();
 }
 
+/*
+ * Returns false if the batch is entirely outside the viewport. The bounds of a
+ * merged batch only change together with its vertex data, so they are only
+ * recomputed when it needs to be uploaded again and a moving batch root costs
+ * one rectangle mapping. Unmerged batches apply the element matrices when
+ * drawing, so their elements can move without an upload.
+ */
+bool Renderer::isBatchVisible(Batch *b)
+{
+    if (b->needsUpload || !b->merged)
+        b->computeBounds();
+    if (!b->cullable)
+        return true;
+
+    QMatrix4x4 matrix = projectionMatrix();
+    if (b->root)
+        matrix = matrix * qsg_matrixForRoot(b->root);
+    if (!QMatrix4x4_Accessor::is2DSafe(matrix))
+        return true;
+
+    Rect deviceBounds = b->bounds;
+    deviceBounds.map(matrix);
+    // NoVertexDisplacement materials may still move vertices by a pixel
+    const QRect viewportPixels = viewportRect();
+    const float marginX = viewportPixels.width() > 0 ? 2.0f / viewportPixels.width() : 0;
+    const float marginY = viewportPixels.height() > 0 ? 2.0f / viewportPixels.height() : 0;
+    Rect viewport;
+    viewport.set(-1 - marginX, -1 - marginY, 1 + marginX, 1 + marginY);
+    return viewport.intersects(deviceBounds);
+}
+
+void Renderer::updateDamageBounds(Element *e)
+{
+    QMatrix4x4 matrix = projectionMatrix();
+    if (e->root)
+        matrix = matrix * qsg_matrixForRoot(e->root);
+
+    e->ensureBoundsValid();
+    e->damageBoundsValid = true;
+    if (e->bounds.isOutsideFloatRange()
+            || !QMatrix4x4_Accessor::is2DSafe(matrix)
+            || !QMatrix4x4_Accessor::is2DSafe(*e->node->matrix())
+            || !QSGMaterialPrivate::hasFlag(e->node->activeMaterial(), QSGMaterialPrivate::NoVertexDisplacement)) {
+        // Unknown area, so any change to it repaints everything. This includes
+        // materials whose vertex shader may move the geometry anywhere.
+        e->damageBounds.set(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX);
+        return;
+    }
+    e->damageBounds = e->bounds;
+    e->damageBounds.map(matrix);
+}
+
+/*
+ * Works out which part of the render target needs to be repainted when partial
+ * updates are enabled, meaning the target still holds the previous frame.
+ *
+ * Each element remembers the area it covered when it was last rendered, and
+ * nodeChanged() collects the elements that may have changed since. The damage
+ * is the union of their old and new areas and the areas of removed elements.
+ * Changes that can't be tracked this way, like render nodes, a different
+ * projection or materials that may displace vertices, repaint the whole target.
+ */
+void Renderer::updateDamage()
+{
+    m_scissorToDamage = false;
+
+    if (!partialUpdatesEnabled()) {
+        for (int i = 0; i < m_damagedElements.size(); ++i)
+            m_damagedElements.at(i)->damaged = false;
+        m_damagedElements.reset();
+        m_removedDamage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        m_fullDamage = false;
+        m_damageValid = false;
+        return;
+    }
+
+    bool full = !m_damageValid
+            || m_fullDamage
+            || !m_renderNodeElements.isEmpty()
+            || m_visualizeMode != VisualizeNothing
+            || deviceRect() != m_damageDeviceRect
+            || viewportRect() != m_damageViewportRect
+            || projectionMatrix() != m_damageProjectionMatrix
+            || clearColor() != m_damageClearColor;
+
+    Rect damage = m_removedDamage;
+    for (int i = 0; i < m_damagedElements.size(); ++i) {
+        Element *e = m_damagedElements.at(i);
+        e->damaged = false;
+        if (full || e->removed)
+            continue;
+        if (e->damageBoundsValid)
+            damage |= e->damageBounds;
+        updateDamageBounds(e);
+        damage |= e->damageBounds;
+    }
+    m_damagedElements.reset();
+    m_removedDamage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    m_fullDamage = false;
+
+    m_damageValid = true;
+    m_damageDeviceRect = deviceRect();
+    m_damageViewportRect = viewportRect();
+    m_damageProjectionMatrix = projectionMatrix();
+    m_damageClearColor = clearColor();
+
+    if (full) {
+        // Everything is repainted, so start over with the current areas
+        for (Node *n : qAsConst(m_nodes)) {
+            if (n->type() == QSGNode::GeometryNodeType && n->element())
+                updateDamageBounds(n->element());
+        }
+        return;
+    }
+
+    m_scissorToDamage = true;
+    damage.tl.x = qMax(damage.tl.x, -1.0f);
+    damage.tl.y = qMax(damage.tl.y, -1.0f);
+    damage.br.x = qMin(damage.br.x, 1.0f);
+    damage.br.y = qMin(damage.br.y, 1.0f);
+    if (damage.tl.x >= damage.br.x || damage.tl.y >= damage.br.y) {
+        m_damage_rect = QRect();
+        return;
+    }
+
+    // From normalized device coordinates to the framebuffer, with a pixel of
+    // margin for antialiasing and rounding.
+    const QRect r = viewportRect();
+    const int viewportY = deviceRect().bottom() - r.bottom();
+    const int x1 = qFloor(r.x() + (damage.tl.x + 1) * 0.5f * r.width()) - 1;
+    const int y1 = qFloor(viewportY + (damage.tl.y + 1) * 0.5f * r.height()) - 1;
+    const int x2 = qCeil(r.x() + (damage.br.x + 1) * 0.5f * r.width()) + 1;
+    const int y2 = qCeil(viewportY + (damage.br.y + 1) * 0.5f * r.height()) + 1;
+    m_damage_rect = QRect(x1, y1, x2 - x1, y2 - y1) & QRect(QPoint(0, 0), deviceRect().size());
+}
+
+/*
+ * Disables scissoring, or limits it to the damaged area for partial updates.
+ */
+void Renderer::resetScissor()
+{
+    if (m_scissorToDamage) {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(m_damage_rect.x(), m_damage_rect.y(), m_damage_rect.width(), m_damage_rect.height());
+    } else {
+        glDisable(GL_SCISSOR_TEST);
+    }
+}
+
 void Renderer::uploadBatch(Batch *b)
 {
         // Early out if nothing has changed in this batch..
@@ -1810,6 +2292,18 @@ void Renderer::uploadBatch(Batch *b)
                         && ((flags & QSGMaterial::RequiresFullMatrixExceptTranslate) == 0 || b->isTranslateOnlyToRoot())
                         && b->isSafeToBatch();
 
+        // Elements that were only transformed keep their place in the buffers
+        if (b->partialUpload && b->merged && canMerge && b->vbo.id
+                && !m_context->hasBrokenIndexBufferObjects() && m_visualizeMode == VisualizeNothing) {
+            uploadTransformedElements(b);
+            b->needsUpload = false;
+            b->partialUpload = false;
+            if (Q_UNLIKELY(debug_render()))
+                b->uploadedThisFrame = true;
+            return;
+        }
+        b->partialUpload = false;
+
         b->merged = canMerge;
 
         // Figure out how much memory we need...
@@ -1878,6 +2372,10 @@ void Renderer::uploadBatch(Batch *b)
                     ? b->ibo.data
                     : zData + (int(m_useDepthBuffer) * b->vertexCount * sizeof(float));
 
+            // Large batches get their vertices copied and transformed in
+            // parallel once the index and z data has been written.
+            const bool parallelCopy = copiesMergedVerticesInParallel(b);
+
             quint16 iOffset = 0;
             e = b->first;
             int verticesInSet = 0;
@@ -1902,9 +2400,12 @@ void Renderer::uploadBatch(Batch *b)
                     verticesInSet = e->node->geometry()->vertexCount();
                     indicesInSet = 0;
                 }
-                uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, &iOffset, &indicesInSet);
+                uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, &iOffset, &indicesInSet, !parallelCopy);
+                e->needsVertexUpload = false;
                 e = e->nextInBatch;
             }
+            if (parallelCopy)
+                copyMergedVerticesInParallel(b);
             b->drawSets.last().indexCount = indicesInSet;
             // We skip the very first and very last degenerate triangles since they aren't needed
             // and the first one would reverse the vertex ordering of the merged strips.
@@ -1988,6 +2489,10 @@ void Renderer::uploadBatch(Batch *b)
         if (separateIndexBuffer)
             unmap(&b->ibo, true);
 
+        // Without a separate index buffer the indices are appended to the vertex buffer
+        m_statistics.vertexBytesUploaded += separateIndexBuffer ? bufferSize : bufferSize - ibufferSize;
+        m_statistics.indexBytesUploaded += ibufferSize;
+
         if (Q_UNLIKELY(debug_upload())) qDebug() << "  --- vertex/index buffers unmapped, batch upload completed...";
 
         b->needsUpload = false;
@@ -2006,7 +2511,7 @@ Renderer::ClipType Renderer::updateStencilClip(const QSGClipNode *clip)
 {
     if (!clip) {
         glDisable(GL_STENCIL_TEST);
-        glDisable(GL_SCISSOR_TEST);
+        resetScissor();
         return NoClip;
     }
 
@@ -2074,8 +2579,11 @@ Renderer::ClipType Renderer::updateStencilClip(const QSGClipNode *clip)
             } else {
                 m_currentScissorRect &= QRect(ix1, iy1, ix2 - ix1, iy2 - iy1);
             }
-            glScissor(m_currentScissorRect.x(), m_currentScissorRect.y(),
-                      m_currentScissorRect.width(), m_currentScissorRect.height());
+            const QRect scissorRect = m_scissorToDamage
+                    ? m_currentScissorRect & m_damage_rect
+                    : m_currentScissorRect;
+            glScissor(scissorRect.x(), scissorRect.y(),
+                      scissorRect.width(), scissorRect.height());
         } else {
             if (!(clipType & StencilClip)) {
                 if (!m_clipProgram.isLinked()) {
@@ -2148,6 +2656,9 @@ Renderer::ClipType Renderer::updateStencilClip(const QSGClipNode *clip)
     if (vbo)
         glDeleteBuffers(1, &vbo);
 
+    if (!(clipType & ScissorClip))
+        resetScissor();
+
     if (clipType & StencilClip) {
         m_clipProgram.disableAttributeArray(0);
         glStencilFunc(GL_EQUAL, m_currentStencilValue, 0xff); // stencil test, ref, test mask
@@ -2228,6 +2739,7 @@ void Renderer::setActiveShader(QSGMaterialShader *program, ShaderManager::Shader
     m_currentShader = shader;
     m_currentMaterial = nullptr;
     if (m_currentProgram) {
+        ++m_statistics.shaderChanges;
         m_currentProgram->program()->bind();
         m_currentProgram->activate();
     }
@@ -2303,6 +2815,8 @@ void Renderer::renderMergedBatch(const Batch *batch)
         sms->lastOpacity = m_current_opacity;
     }
 
+    if (material != m_currentMaterial)
+        ++m_statistics.materialChanges;
     program->updateState(state(dirty), material, m_currentMaterial);
 
 #ifndef QT_NO_DEBUG
@@ -2419,6 +2933,8 @@ void Renderer::renderUnmergedBatch(const Batch *batch)
             m_current_projection_matrix(2, 3) = 1.0f - e->order * m_zRange;
         }
 
+        if (material != m_currentMaterial)
+            ++m_statistics.materialChanges;
         program->updateState(state(dirty), material, m_currentMaterial);
 
 #ifndef QT_NO_DEBUG
@@ -2511,7 +3027,7 @@ void Renderer::renderBatches()
     }
     glDisable(GL_CULL_FACE);
     glColorMask(true, true, true, true);
-    glDisable(GL_SCISSOR_TEST);
+    resetScissor();
     glDisable(GL_STENCIL_TEST);
 
     bindable()->clear(clearMode());
@@ -2528,6 +3044,8 @@ void Renderer::renderBatches()
     if (Q_LIKELY(renderOpaque)) {
         for (int i=0; i<m_opaqueBatches.size(); ++i) {
             Batch *b = m_opaqueBatches.at(i);
+            if (b->culled)
+                continue;
             if (b->merged)
                 renderMergedBatch(b);
             else
@@ -2543,6 +3061,8 @@ void Renderer::renderBatches()
     if (Q_LIKELY(renderAlpha)) {
         for (int i=0; i<m_alphaBatches.size(); ++i) {
             Batch *b = m_alphaBatches.at(i);
+            if (b->culled)
+                continue;
             if (b->merged)
                 renderMergedBatch(b);
             else if (b->isRenderNode)
@@ -2555,6 +3075,7 @@ void Renderer::renderBatches()
     if (m_currentShader)
         setActiveShader(nullptr, nullptr);
     updateStencilClip(nullptr);
+    glDisable(GL_SCISSOR_TEST);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     glDepthMask(true);
@@ -2595,6 +3116,24 @@ void Renderer::render()
         QSGNodeDumper::dump(rootNode());
     }
 
+    if (m_rebuild == FullRebuild)
+        m_statistics.rebuild = QSGRendererStatistics::RebuildFull;
+    else if (m_rebuild & BuildRenderLists)
+        m_statistics.rebuild = QSGRendererStatistics::RebuildRenderLists;
+    else if (m_rebuild & BuildRenderListsForTaggedRoots)
+        m_statistics.rebuild = QSGRendererStatistics::RebuildPartialRenderLists;
+    else if (m_rebuild & BuildBatches)
+        m_statistics.rebuild = QSGRendererStatistics::RebuildBatches;
+    else
+        m_statistics.rebuild = QSGRendererStatistics::RebuildNone;
+    m_statistics.vertexBytesUploaded = 0;
+    m_statistics.indexBytesUploaded = 0;
+    m_statistics.materialChanges = 0;
+    m_statistics.shaderChanges = 0;
+
+    // Before deleteRemovedElements(), as the damaged elements may include them
+    updateDamage();
+
     QElapsedTimer timer;
     quint64 timeRenderLists = 0;
     quint64 timePrepareOpaque = 0;
@@ -2708,12 +3247,21 @@ void Renderer::render()
     int largestVBO = 0;
     int largestIBO = 0;
 
+    // Batches outside the viewport are neither uploaded nor drawn. Pending
+    // uploads stay pending until the batch becomes visible again.
+    const bool cullBatches = m_cullBatches && m_visualizeMode == VisualizeNothing;
+    m_statistics.culledBatches = 0;
+
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
     for (int i=0; i<m_opaqueBatches.size(); ++i) {
         Batch *b = m_opaqueBatches.at(i);
         largestVBO = qMax(b->vbo.size, largestVBO);
         largestIBO = qMax(b->ibo.size, largestIBO);
-        uploadBatch(b);
+        b->culled = cullBatches && !isBatchVisible(b);
+        if (b->culled)
+            ++m_statistics.culledBatches;
+        else
+            uploadBatch(b);
     }
     if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
 
@@ -2721,18 +3269,32 @@ void Renderer::render()
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
     for (int i=0; i<m_alphaBatches.size(); ++i) {
         Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
+        b->culled = cullBatches && !isBatchVisible(b);
+        if (b->culled)
+            ++m_statistics.culledBatches;
+        else
+            uploadBatch(b);
         largestVBO = qMax(b->vbo.size, largestVBO);
         largestIBO = qMax(b->ibo.size, largestIBO);
     }
     if (Q_UNLIKELY(debug_render())) timeUploadAlpha = timer.restart();
 
+    m_statistics.opaqueBatches = m_opaqueBatches.size();
+    m_statistics.alphaBatches = m_alphaBatches.size();
+    m_statistics.mergedBatches = 0;
+    for (int i=0; i<m_opaqueBatches.size(); ++i)
+        m_statistics.mergedBatches += m_opaqueBatches.at(i)->merged;
+    for (int i=0; i<m_alphaBatches.size(); ++i)
+        m_statistics.mergedBatches += m_alphaBatches.at(i)->merged;
+    m_statistics.unmergedBatches = m_statistics.opaqueBatches + m_statistics.alphaBatches - m_statistics.mergedBatches;
+
     if (largestVBO * 2 < m_vertexUploadPool.size())
         m_vertexUploadPool.resize(largestVBO * 2);
     if (m_context->separateIndexBuffer() && largestIBO * 2 < m_indexUploadPool.size())
         m_indexUploadPool.resize(largestIBO * 2);
 
-    renderBatches();
+    if (!m_scissorToDamage || !m_damage_rect.isEmpty())
+        renderBatches();
 
     if (Q_UNLIKELY(debug_render())) {
         qDebug(" -> times: build: %d, prepare(opaque/alpha): %d/%d, sorting: %d, upload(opaque/alpha): %d/%d, render: %d",
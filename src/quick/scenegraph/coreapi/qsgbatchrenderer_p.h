@@ -66,6 +66,7 @@
 QT_BEGIN_NAMESPACE
 
 class QOpenGLVertexArrayObject;
+class QThreadPool;
 
 namespace QSGBatchRenderer
 {
@@ -241,6 +242,11 @@ inline QDebug operator << (QDebug d, const Pt &p) {
     return d;
 }
 
+// Transform the 2D float positions at the start of each vertex in place. The
+// scalar version is the reference for the SSE2 and NEON code paths.
+Q_AUTOTEST_EXPORT void qsg_transformPositions(char *vdata, int vCount, int vSize, const QMatrix4x4 &localx);
+Q_AUTOTEST_EXPORT void qsg_transformPositionsScalar(char *vdata, int vCount, int vSize, const QMatrix4x4 &localx);
+
 
 
 struct Rect {
@@ -312,6 +318,9 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , needsVertexUpload(false)
+        , damaged(false)
+        , damageBoundsValid(false)
     {
     }
 
@@ -332,6 +341,7 @@ struct Element {
     Node *root = nullptr;
 
     Rect bounds; // in device coordinates
+    Rect damageBounds; // in normalized device coordinates, when last rendered
 
     int order = 0;
 
@@ -342,6 +352,9 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint needsVertexUpload : 1; // only transformed since the last upload, see Batch::partialUpload
+    uint damaged : 1; // in Renderer::m_damagedElements
+    uint damageBoundsValid : 1; // false until first rendered with partial updates
 };
 
 struct RenderNodeElement : public Element {
@@ -397,6 +410,7 @@ struct Batch
     BatchCompatibility isMaterialCompatible(Element *e) const;
     void invalidate();
     void cleanupRemovedElements();
+    void computeBounds();
 
     bool isTranslateOnlyToRoot() const;
     bool isSafeToBatch() const;
@@ -409,10 +423,13 @@ struct Batch
         indexCount = 0;
         isOpaque = false;
         needsUpload = false;
+        partialUpload = false;
         merged = false;
         positionAttribute = -1;
         uploadedThisFrame = false;
         isRenderNode = false;
+        cullable = false;
+        culled = false;
     }
 
     Element *first;
@@ -425,10 +442,19 @@ struct Batch
 
     int lastOrderInBatch;
 
+    Rect bounds; // relative to root, valid when cullable
+
     uint isOpaque : 1;
     uint needsUpload : 1;
+    // All pending changes are transformed elements, so the buffer layout is
+    // unchanged and only their vertices need to be uploaded again
+    uint partialUpload : 1;
     uint merged : 1;
     uint isRenderNode : 1;
+    // bounds are finite and all elements are 2D, so the batch can be culled
+    uint cullable : 1;
+    // outside the viewport this frame, neither uploaded nor drawn
+    uint culled : 1;
 
     mutable uint uploadedThisFrame : 1; // solely for debugging purposes
 
@@ -657,8 +683,18 @@ private:
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
 
+    void damageSubtree(Node *node);
+    void damageRemovedSubtree(Node *node);
+    void updateDamageBounds(Element *e);
+    void updateDamage();
+    void resetScissor();
+
+    bool isBatchVisible(Batch *b);
     void uploadBatch(Batch *b);
-    void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount);
+    void uploadTransformedElements(Batch *b);
+    void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount, bool copyVertices);
+    bool copiesMergedVerticesInParallel(const Batch *b) const;
+    void copyMergedVerticesInParallel(Batch *b);
 
     void renderBatches();
     void renderMergedBatch(const Batch *batch);
@@ -721,6 +757,7 @@ private:
     GLuint m_bufferStrategy;
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
+    bool m_cullBatches;
 
     // Stuff used during rendering only...
     ShaderManager *m_shaderManager;
@@ -735,11 +772,26 @@ private:
     const QSGClipNode *m_currentClip;
     ClipType m_currentClipType;
 
+    // Damage tracking for partial updates, see updateDamage()
+    QDataBuffer<Element *> m_damagedElements;
+    Rect m_removedDamage;
+    bool m_fullDamage;
+    bool m_damageValid;
+    bool m_scissorToDamage;
+    QRect m_damageDeviceRect;
+    QRect m_damageViewportRect;
+    QMatrix4x4 m_damageProjectionMatrix;
+    QColor m_damageClearColor;
+
     QDataBuffer<char> m_vertexUploadPool;
     QDataBuffer<char> m_indexUploadPool;
     // For minimal OpenGL core profile support
     QOpenGLVertexArrayObject *m_vao;
 
+    // Copies the vertices of large merged batches, created on first use
+    QThreadPool *m_uploadThreadPool;
+    int m_uploadThreadCount;
+
     QHash<Node *, uint> m_visualizeChanceSet;
     VisualizeMode m_visualizeMode;
 
@@ -46,18 +46,12 @@
 #endif
 #include <private/qquickprofiler_p.h>
 
-#include <QtCore/QElapsedTimer>
-
 QT_BEGIN_NAMESPACE
 
 #if QT_CONFIG(opengl)
 static const bool qsg_sanity_check = qEnvironmentVariableIntValue("QSG_SANITY_CHECK");
 #endif
 
-static QElapsedTimer frameTimer;
-static qint64 preprocessTime;
-static qint64 updatePassTime;
-
 int qt_sg_envInt(const char *name, int defaultValue)
 {
     if (Q_LIKELY(!qEnvironmentVariableIsSet(name)))
@@ -134,7 +128,10 @@ QSGRenderer::QSGRenderer(QSGRenderContext *context)
     , m_context(context)
     , m_node_updater(nullptr)
     , m_bindable(nullptr)
+    , m_preprocessTime(0)
+    , m_updatePassTime(0)
     , m_changed_emitted(false)
+    , m_partial_updates(false)
     , m_is_rendering(false)
     , m_is_preprocessing(false)
 {
@@ -209,20 +206,19 @@ void QSGRenderer::renderScene(const QSGBindable &bindable)
     m_is_rendering = true;
 
 
-    bool profileFrames = QSG_LOG_TIME_RENDERER().isDebugEnabled();
-    if (profileFrames)
-        frameTimer.start();
+    // The timer is cheap enough to keep the statistics up to date for every frame
+    m_frameTimer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphRendererFrame);
 
     qint64 bindTime = 0;
     qint64 renderTime = 0;
 
     m_bindable = &bindable;
+    m_damage_rect = QRect(QPoint(0, 0), deviceRect().size());
     preprocess();
 
     bindable.bind();
-    if (profileFrames)
-        bindTime = frameTimer.nsecsElapsed();
+    bindTime = m_frameTimer.nsecsElapsed();
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRendererFrame,
                               QQuickProfiler::SceneGraphRendererBinding);
 
@@ -242,8 +238,7 @@ void QSGRenderer::renderScene(const QSGBindable &bindable)
 #endif
 
     render();
-    if (profileFrames)
-        renderTime = frameTimer.nsecsElapsed();
+    renderTime = m_frameTimer.nsecsElapsed();
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRendererFrame,
                            QQuickProfiler::SceneGraphRendererRender);
 
@@ -251,12 +246,17 @@ void QSGRenderer::renderScene(const QSGBindable &bindable)
     m_changed_emitted = false;
     m_bindable = nullptr;
 
+    m_statistics.preprocessTime = m_preprocessTime;
+    m_statistics.updateTime = m_updatePassTime - m_preprocessTime;
+    m_statistics.bindingTime = bindTime - m_updatePassTime;
+    m_statistics.renderTime = renderTime - bindTime;
+
     qCDebug(QSG_LOG_TIME_RENDERER,
             "time in renderer: total=%dms, preprocess=%d, updates=%d, binding=%d, rendering=%d",
             int(renderTime / 1000000),
-            int(preprocessTime / 1000000),
-            int((updatePassTime - preprocessTime) / 1000000),
-            int((bindTime - updatePassTime) / 1000000),
+            int(m_preprocessTime / 1000000),
+            int((m_updatePassTime - m_preprocessTime) / 1000000),
+            int((bindTime - m_updatePassTime) / 1000000),
             int((renderTime - bindTime) / 1000000));
 }
 
@@ -313,16 +313,13 @@ void QSGRenderer::preprocess()
         }
     }
 
-    bool profileFrames = QSG_LOG_TIME_RENDERER().isDebugEnabled();
-    if (profileFrames)
-        preprocessTime = frameTimer.nsecsElapsed();
+    m_preprocessTime = m_frameTimer.nsecsElapsed();
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRendererFrame,
                               QQuickProfiler::SceneGraphRendererPreprocess);
 
     nodeUpdater()->updateStates(root);
 
-    if (profileFrames)
-        updatePassTime = frameTimer.nsecsElapsed();
+    m_updatePassTime = m_frameTimer.nsecsElapsed();
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRendererFrame,
                               QQuickProfiler::SceneGraphRendererUpdate);
 
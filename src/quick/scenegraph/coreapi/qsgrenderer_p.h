@@ -58,6 +58,8 @@
 
 #include <QtQuick/private/qsgcontext_p.h>
 
+#include <QtCore/QElapsedTimer>
+
 QT_BEGIN_NAMESPACE
 
 class QSGBindable;
@@ -66,6 +68,38 @@ class QSGNodeUpdater;
 Q_QUICK_PRIVATE_EXPORT bool qsg_test_and_clear_fatal_render_error();
 Q_QUICK_PRIVATE_EXPORT void qsg_set_fatal_renderer_error();
 
+// Per frame statistics, times are in nanoseconds. Renderers that do not
+// batch leave the batch, upload and state change counters at zero.
+struct QSGRendererStatistics
+{
+    enum Rebuild {
+        RebuildNone,
+        RebuildBatches,
+        RebuildPartialRenderLists,
+        RebuildRenderLists,
+        RebuildFull
+    };
+
+    qint64 preprocessTime = 0;
+    qint64 updateTime = 0;
+    qint64 bindingTime = 0;
+    qint64 renderTime = 0;
+
+    int opaqueBatches = 0;
+    int alphaBatches = 0;
+    int mergedBatches = 0;
+    int unmergedBatches = 0;
+    int culledBatches = 0;
+
+    qint64 vertexBytesUploaded = 0;
+    qint64 indexBytesUploaded = 0;
+
+    int materialChanges = 0;
+    int shaderChanges = 0;
+
+    Rebuild rebuild = RebuildNone;
+};
+
 class Q_QUICK_PRIVATE_EXPORT QSGRenderer : public QSGAbstractRenderer
 {
 public:
@@ -97,6 +131,15 @@ public:
 
     void clearChangedFlag() { m_changed_emitted = false; }
 
+    // Describes the last frame rendered by renderScene()
+    const QSGRendererStatistics &statistics() const { return m_statistics; }
+
+    // Only to be enabled when the render target keeps its content between frames
+    void setPartialUpdatesEnabled(bool enabled) { m_partial_updates = enabled; }
+    bool partialUpdatesEnabled() const { return m_partial_updates; }
+    // The area repainted by the last frame, in framebuffer coordinates
+    QRect damageRect() const { return m_damage_rect; }
+
 protected:
     virtual void render() = 0;
 
@@ -115,6 +158,9 @@ protected:
 
     QSGRenderContext *m_context;
 
+    QSGRendererStatistics m_statistics;
+    QRect m_damage_rect;
+
 private:
     QSGNodeUpdater *m_node_updater;
 
@@ -123,7 +169,12 @@ private:
 
     const QSGBindable *m_bindable;
 
+    QElapsedTimer m_frameTimer;
+    qint64 m_preprocessTime;
+    qint64 m_updatePassTime;
+
     uint m_changed_emitted : 1;
+    uint m_partial_updates : 1;
     uint m_is_rendering : 1;
     uint m_is_preprocessing : 1;
 };
@@ -42,6 +42,7 @@
 #include <qmath.h>
 #include <QtQuick/private/qsgdistancefieldglyphnode_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgdistancefieldglyphstore_p.h>
 #include <private/qrawfont_p.h>
 #include <QtGui/qguiapplication.h>
 #include <qdir.h>
@@ -71,6 +72,8 @@ QSGDistanceFieldGlyphCache::QSGDistanceFieldGlyphCache(QOpenGLContext *c, const
     // this allows us to call pathForGlyph once and reuse the result.
     m_referenceFont.setPixelSize(QT_DISTANCEFIELD_BASEFONTSIZE(m_doubleGlyphResolution) * QT_DISTANCEFIELD_SCALE(m_doubleGlyphResolution));
     Q_ASSERT(m_referenceFont.isValid());
+
+    m_storeKey = QSGDistanceFieldGlyphStore::fontKey(font);
 #if QT_CONFIG(opengl)
     m_coreProfile = (c->format().profile() == QSurfaceFormat::CoreProfile);
 #else
@@ -172,14 +175,22 @@ void QSGDistanceFieldGlyphCache::update()
         qsg_render_timer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphAdaptationLayerFrame);
 
+    QSGDistanceFieldGlyphStore *store = QSGDistanceFieldGlyphStore::instance();
+    int storedCount = 0;
+
     QList<QDistanceField> distanceFields;
     const int pendingGlyphsSize = m_pendingGlyphs.size();
     distanceFields.reserve(pendingGlyphsSize);
     for (int i = 0; i < pendingGlyphsSize; ++i) {
         GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
-        distanceFields.append(QDistanceField(gd.path,
-                                             m_pendingGlyphs.at(i),
-                                             m_doubleGlyphResolution));
+        QDistanceField field = store->find(m_storeKey, m_pendingGlyphs.at(i));
+        if (field.isNull()) {
+            field = QDistanceField(gd.path, m_pendingGlyphs.at(i), m_doubleGlyphResolution);
+            store->insert(m_storeKey, field);
+        } else {
+            ++storedCount;
+        }
+        distanceFields.append(field);
         gd.path = QPainterPath(); // no longer needed, so release memory used by the painter path
     }
 
@@ -202,11 +213,12 @@ void QSGDistanceFieldGlyphCache::update()
     if (QSG_LOG_TIME_GLYPH().isDebugEnabled()) {
         quint64 now = qsg_render_timer.elapsed();
         qCDebug(QSG_LOG_TIME_GLYPH,
-                "distancefield: %d glyphs prepared in %dms, rendering=%d, upload=%d",
+                "distancefield: %d glyphs prepared in %dms, rendering=%d, upload=%d, from store=%d",
                 count,
                 (int) now,
                 int(renderTime / 1000000),
-                int((now - (renderTime / 1000000))));
+                int((now - (renderTime / 1000000))),
+                storedCount);
     }
     Q_QUICK_SG_PROFILE_END_WITH_PAYLOAD(QQuickProfiler::SceneGraphAdaptationLayerFrame,
                                         QQuickProfiler::SceneGraphAdaptationLayerGlyphStore,
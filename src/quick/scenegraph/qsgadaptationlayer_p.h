@@ -512,6 +512,7 @@ protected:
 
 private:
     QRawFont m_referenceFont;
+    QByteArray m_storeKey;
     int m_glyphCount;
 
     bool m_doubleGlyphResolution;
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qsgdefaultglyphnode_p_p.h"
+#include <private/qsgmaterial_p.h>
 #include <private/qsgmaterialshader_p.h>
 
 #include <qopenglshaderprogram.h>
@@ -418,6 +419,8 @@ void QSGTextMaskMaterial::init(QFontEngine::GlyphFormat glyphFormat)
 
     setFlag(Blending, true);
 
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
+
     QOpenGLContext *ctx = const_cast<QOpenGLContext *>(QOpenGLContext::currentContext());
     Q_ASSERT(ctx != nullptr);
 
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qsgdefaultinternalimagenode_p.h"
+#include <private/qsgmaterial_p.h>
 #include <private/qsgmaterialshader_p.h>
 #include <private/qsgtexturematerial_p.h>
 #include <QtGui/qopenglfunctions.h>
@@ -64,6 +65,7 @@ QSGSmoothTextureMaterial::QSGSmoothTextureMaterial()
 {
     setFlag(RequiresFullMatrixExceptTranslate, true);
     setFlag(Blending, true);
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 void QSGSmoothTextureMaterial::setTexture(QSGTexture *texture)
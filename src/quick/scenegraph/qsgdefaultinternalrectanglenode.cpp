@@ -44,6 +44,7 @@
 #include <QtQuick/qsgtexturematerial.h>
 
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgmaterial_p.h>
 
 #include <QtCore/qmath.h>
 #include <QtCore/qvarlengtharray.h>
@@ -109,6 +110,7 @@ QSGSmoothColorMaterial::QSGSmoothColorMaterial()
 {
     setFlag(RequiresFullMatrixExceptTranslate, true);
     setFlag(Blending, true);
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 int QSGSmoothColorMaterial::compare(const QSGMaterial *) const
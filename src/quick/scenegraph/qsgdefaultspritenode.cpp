@@ -40,6 +40,7 @@
 #include "qsgdefaultspritenode_p.h"
 
 #include <QtQuick/QSGMaterial>
+#include <QtQuick/private/qsgmaterial_p.h>
 #include <QtGui/QOpenGLShaderProgram>
 
 QT_BEGIN_NAMESPACE
@@ -84,6 +85,7 @@ public:
 QQuickSpriteMaterial::QQuickSpriteMaterial()
 {
     setFlag(Blending, true);
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 QQuickSpriteMaterial::~QQuickSpriteMaterial()
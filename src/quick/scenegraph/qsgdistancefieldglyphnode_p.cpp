@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qsgdistancefieldglyphnode_p_p.h"
+#include <QtQuick/private/qsgmaterial_p.h>
 #include <QtQuick/private/qsgtexture_p.h>
 #include <QtGui/qopenglfunctions.h>
 #include <QtGui/qsurface.h>
@@ -213,6 +214,7 @@ QSGDistanceFieldTextMaterial::QSGDistanceFieldTextMaterial()
     , m_fontScale(1.0)
 {
    setFlag(Blending | RequiresDeterminant, true);
+   QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 QSGDistanceFieldTextMaterial::~QSGDistanceFieldTextMaterial()
@@ -44,6 +44,7 @@
 #include <QtCore/QAnimationDriver>
 #include <QtCore/QQueue>
 #include <QtCore/QTime>
+#include <QtCore/QVarLengthArray>
 
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
@@ -94,6 +95,9 @@
    ---
 
    There is one thread per window and one opengl context per thread.
+   When QSG_RENDER_THREADS is set, windows are instead distributed
+   round-robin over that many threads, and the windows of a thread
+   share its opengl context and render context.
 
    ---
 
@@ -272,11 +276,10 @@ public:
         : wm(w)
         , gl(nullptr)
         , animatorDriver(nullptr)
-        , pendingUpdate(0)
         , sleeping(false)
         , syncResultedInChanges(false)
+        , animatorsAdvanced(false)
         , active(false)
-        , window(nullptr)
         , stopEventProcessing(false)
     {
         sgrc = static_cast<QSGDefaultRenderContext *>(renderContext);
@@ -285,6 +288,7 @@ public:
         setStackSize(1024 * 1024);
 #endif
         vsyncDelta = qsgrl_animation_interval();
+        frameClock.start();
     }
 
     ~QSGRenderThread()
@@ -292,21 +296,53 @@ public:
         delete sgrc;
     }
 
+    enum UpdateRequest {
+        SyncRequest         = 0x01,
+        RepaintRequest      = 0x02,
+        ExposeRequest       = 0x04 | RepaintRequest | SyncRequest
+    };
+
+    // An exposed window rendered by this thread
+    struct RenderWindow {
+        QQuickWindow *window;
+        QSize size;
+        uint pendingUpdate;
+        uint frameUpdate; // The requests handled in the current round
+        bool syncResultedInChanges;
+        qint64 syncTime;
+        qint64 lastSwapTime;
+    };
+
     void invalidateOpenGL(QQuickWindow *window, bool inDestructor, QOffscreenSurface *backupSurface);
     void initializeOpenGL();
+    bool usedByOtherWindows(QQuickWindow *window) const;
+    void cleanupNodesOnShutdown();
 
     bool event(QEvent *) override;
     void run() override;
 
-    void syncAndRender();
-    void sync(bool inExpose);
+    void renderWindows();
+    void beginFrameTiming();
+    bool syncAndRender(RenderWindow *rw);
+    void sync(RenderWindow *rw, bool inExpose);
+    void updateAnimationControllers();
+    void advanceAnimators();
 
-    void requestRepaint()
+    void requestRepaint(QQuickWindow *window)
     {
         if (sleeping)
             stopEventProcessing = true;
-        if (window)
-            pendingUpdate |= RepaintRequest;
+        if (RenderWindow *rw = windowFor(windows, window))
+            rw->pendingUpdate |= RepaintRequest;
+    }
+
+    bool hasPendingUpdates() const
+    {
+        for (const RenderWindow &rw : windows) {
+            if (rw.pendingUpdate)
+                return true;
+        }
+        return false;
     }
 
     void processEventsAndWaitForMore();
@@ -320,21 +356,17 @@ public slots:
     }
 
 public:
-    enum UpdateRequest {
-        SyncRequest         = 0x01,
-        RepaintRequest      = 0x02,
-        ExposeRequest       = 0x04 | RepaintRequest | SyncRequest
-    };
-
     QSGThreadedRenderLoop *wm;
     QOpenGLContext *gl;
     QSGDefaultRenderContext *sgrc;
 
     QAnimationDriver *animatorDriver;
+    // The controllers of all windows on this thread, exposed or not
+    QVector<QQuickAnimatorController *> animationControllers;
 
-    uint pendingUpdate;
     bool sleeping;
     bool syncResultedInChanges;
+    bool animatorsAdvanced;
 
     volatile bool active;
 
@@ -343,10 +375,9 @@ public:
     QMutex mutex;
     QWaitCondition waitCondition;
 
-    QElapsedTimer m_timer;
+    QElapsedTimer frameClock;
 
-    QQuickWindow *window; // Will be 0 when window is not exposed
-    QSize windowSize;
+    QList<RenderWindow> windows; // Only windows that are exposed
 
     // Local event queue stuff...
     bool stopEventProcessing;
@@ -359,14 +390,16 @@ bool QSGRenderThread::event(QEvent *e)
 
     case WM_Obscure: {
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "WM_Obscure");
-
-        Q_ASSERT(!window || window == static_cast<WMWindowEvent *>(e)->window);
+        QQuickWindow *window = static_cast<WMWindowEvent *>(e)->window;
 
         mutex.lock();
-        if (window) {
-            QQuickWindowPrivate::get(window)->fireAboutToStop();
-            qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- window removed");
-            window = nullptr;
+        for (int i = 0; i < windows.size(); ++i) {
+            if (windows.at(i).window == window) {
+                QQuickWindowPrivate::get(window)->fireAboutToStop();
+                qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- window removed");
+                windows.removeAt(i);
+                break;
+            }
         }
         waitCondition.wakeOne();
         mutex.unlock();
@@ -378,17 +411,29 @@ bool QSGRenderThread::event(QEvent *e)
         WMSyncEvent *se = static_cast<WMSyncEvent *>(e);
         if (sleeping)
             stopEventProcessing = true;
-        window = se->window;
-        windowSize = se->size;
+        RenderWindow *rw = windowFor(windows, se->window);
+        if (!rw) {
+            qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- window added");
+            RenderWindow win;
+            win.window = se->window;
+            win.pendingUpdate = 0;
+            win.frameUpdate = 0;
+            win.syncResultedInChanges = false;
+            win.syncTime = 0;
+            win.lastSwapTime = -1;
+            windows << win;
+            rw = &windows.last();
+        }
+        rw->size = se->size;
 
-        pendingUpdate |= SyncRequest;
+        rw->pendingUpdate |= SyncRequest;
         if (se->syncInExpose) {
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- triggered from expose");
-            pendingUpdate |= ExposeRequest;
+            rw->pendingUpdate |= ExposeRequest;
         }
         if (se->forceRenderPass) {
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- repaint regardless");
-            pendingUpdate |= RepaintRequest;
+            rw->pendingUpdate |= RepaintRequest;
         }
         return true; }
 
@@ -397,21 +442,19 @@ bool QSGRenderThread::event(QEvent *e)
         mutex.lock();
         wm->m_lockedForSync = true;
         WMTryReleaseEvent *wme = static_cast<WMTryReleaseEvent *>(e);
-        if (!window || wme->inDestructor) {
+        if (!windowFor(windows, wme->window) || wme->inDestructor) {
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- setting exit flag and invalidating OpenGL");
             invalidateOpenGL(wme->window, wme->inDestructor, wme->fallbackSurface);
             active = gl;
-            Q_ASSERT_X(!wme->inDestructor || !active, "QSGRenderThread::invalidateOpenGL()", "Thread's active state is not set to false when shutting down");
+            Q_ASSERT_X(!wme->inDestructor || !active || usedByOtherWindows(wme->window), "QSGRenderThread::invalidateOpenGL()", "Thread's active state is not set to false when shutting down");
             if (sleeping)
                 stopEventProcessing = true;
         } else {
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- not releasing because window is still active");
-            if (window) {
-                QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
-                if (d->renderer) {
-                    qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- requesting renderer to release cached resources");
-                    d->renderer->releaseCachedResources();
-                }
+            QQuickWindowPrivate *d = QQuickWindowPrivate::get(wme->window);
+            if (d->renderer) {
+                qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- requesting renderer to release cached resources");
+                d->renderer->releaseCachedResources();
             }
         }
         waitCondition.wakeOne();
@@ -424,9 +467,10 @@ bool QSGRenderThread::event(QEvent *e)
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "WM_Grab");
         WMGrabEvent *ce = static_cast<WMGrabEvent *>(e);
         Q_ASSERT(ce->window);
-        Q_ASSERT(ce->window == window || !window);
         mutex.lock();
         if (ce->window) {
+            RenderWindow *rw = windowFor(windows, ce->window);
+            const QSize windowSize = rw ? rw->size : ce->window->size();
             gl->makeCurrent(ce->window);
 
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- sync scene graph");
@@ -451,9 +495,8 @@ bool QSGRenderThread::event(QEvent *e)
     case WM_PostJob: {
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "WM_PostJob");
         WMJobEvent *ce = static_cast<WMJobEvent *>(e);
-        Q_ASSERT(ce->window == window);
-        if (window) {
-            gl->makeCurrent(window);
+        if (windowFor(windows, ce->window)) {
+            gl->makeCurrent(ce->window);
             ce->job->run();
             delete ce->job;
             ce->job = nullptr;
@@ -466,7 +509,8 @@ bool QSGRenderThread::event(QEvent *e)
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "WM_RequestPaint");
         // When GUI posts this event, it is followed by a polishAndSync, so we mustn't
         // exit the event loop yet.
-        pendingUpdate |= RepaintRequest;
+        for (RenderWindow &rw : windows)
+            rw.pendingUpdate |= RepaintRequest;
         break;
 
     default:
@@ -490,6 +534,8 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
 
     bool wipeSG = inDestructor || !window->isPersistentSceneGraph();
     bool wipeGL = inDestructor || (wipeSG && !window->isPersistentOpenGLContext());
+    // Windows sharing this thread keep using its render and OpenGL contexts
+    bool shared = usedByOtherWindows(window);
 
     bool current = gl->makeCurrent(fallback ? static_cast<QSurface *>(fallback) : static_cast<QSurface *>(window));
     if (Q_UNLIKELY(!current)) {
@@ -499,7 +545,8 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
     QQuickWindowPrivate *dd = QQuickWindowPrivate::get(window);
 
 #if QT_CONFIG(quick_shadereffect)
-    QQuickOpenGLShaderEffectMaterial::cleanupMaterialCache();
+    if (!shared)
+        QQuickOpenGLShaderEffectMaterial::cleanupMaterialCache();
 #endif
 
     // The canvas nodes must be cleaned up regardless if we are in the destructor..
@@ -512,11 +559,25 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
         return;
     }
 
+    if (shared) {
+        qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- render context used by other windows, avoiding cleanup");
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        if (inDestructor) {
+            animationControllers.removeOne(dd->animationController);
+            delete dd->animationController;
+        }
+        if (current)
+            gl->doneCurrent();
+        return;
+    }
+
     sgrc->invalidate();
     QCoreApplication::processEvents();
     QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
-    if (inDestructor)
+    if (inDestructor) {
+        animationControllers.removeOne(dd->animationController);
         delete dd->animationController;
+    }
     if (current)
         gl->doneCurrent();
     qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- invalidating scene graph");
@@ -530,23 +591,53 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
     }
 }
 
+/*
+    Returns true if windows other than \a window have a scene graph on this
+    thread's render context. Must only be called while the GUI is blocked.
+ */
+bool QSGRenderThread::usedByOtherWindows(QQuickWindow *window) const
+{
+    for (const QSGThreadedRenderLoop::Window &w : qAsConst(wm->m_windows)) {
+        if (w.thread != this || w.window == window)
+            continue;
+        if (windowFor(windows, w.window) || QQuickWindowPrivate::get(w.window)->renderer)
+            return true;
+    }
+    return false;
+}
+
+/*
+    Cleans up the scene graph of every window using this thread's render
+    context. Must only be called while the GUI is blocked.
+ */
+void QSGRenderThread::cleanupNodesOnShutdown()
+{
+    for (const QSGThreadedRenderLoop::Window &w : qAsConst(wm->m_windows)) {
+        if (w.thread == this)
+            QQuickWindowPrivate::get(w.window)->cleanupNodesOnShutdown();
+    }
+}
+
 /*
     Enters the mutex lock to make sure GUI is blocking and performs
     sync, then wakes GUI.
  */
-void QSGRenderThread::sync(bool inExpose)
+void QSGRenderThread::sync(RenderWindow *rw, bool inExpose)
 {
     qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "sync()");
     mutex.lock();
 
     Q_ASSERT_X(wm->m_lockedForSync, "QSGRenderThread::sync()", "sync triggered on bad terms as gui is not already locked...");
 
+    updateAnimationControllers();
+
+    QQuickWindow *window = rw->window;
     bool current = false;
-    if (windowSize.width() > 0 && windowSize.height() > 0)
+    if (rw->size.width() > 0 && rw->size.height() > 0)
         current = gl->makeCurrent(window);
     // Check for context loss.
     if (!current && !gl->isValid()) {
-        QQuickWindowPrivate::get(window)->cleanupNodesOnShutdown();
+        cleanupNodesOnShutdown();
         sgrc->invalidate();
         current = gl->create() && gl->makeCurrent(window);
         if (current)
@@ -582,31 +673,135 @@ void QSGRenderThread::sync(bool inExpose)
     }
 }
 
-void QSGRenderThread::syncAndRender()
+/*
+    Renders a frame for every exposed window that needs one, one window
+    after the other as they all share the OpenGL context.
+
+    The GUI thread blocks in polishAndSync() until its window is synced, so
+    all pending syncs are done before any window renders and swaps. An expose
+    keeps the GUI thread blocked until the window has rendered, so that
+    window is synced and rendered first.
+ */
+void QSGRenderThread::renderWindows()
 {
-    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
-    if (profileFrames) {
+    QElapsedTimer waitTimer;
+    waitTimer.start();
+
+    animatorsAdvanced = false;
+    bool synced = false;
+    bool rendered = false;
+
+    // The timing of the first frame includes the syncs
+    beginFrameTiming();
+
+    QVarLengthArray<int, 8> renderOrder;
+    for (int i = 0; i < windows.size(); ++i) {
+        RenderWindow *rw = &windows[i];
+        rw->frameUpdate = rw->pendingUpdate;
+        rw->pendingUpdate = 0;
+        rw->syncResultedInChanges = false;
+        rw->syncTime = 0;
+        if (!rw->frameUpdate && !QQuickWindowPrivate::get(rw->window)->customRenderStage)
+            continue;
+        if (!sgrc->openglContext() && rw->size.width() > 0 && rw->size.height() > 0 && gl->makeCurrent(rw->window))
+            sgrc->initialize(gl);
+        synced = true;
+
+        if ((rw->frameUpdate & ExposeRequest) == ExposeRequest) {
+            renderOrder.prepend(i);
+            continue;
+        }
+        renderOrder.append(i);
+        if (rw->frameUpdate & SyncRequest) {
+            qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- updatePending, doing sync");
+            const qint64 syncStart = frameClock.nsecsElapsed();
+            syncResultedInChanges = false;
+            sync(rw, false);
+            rw->syncResultedInChanges = syncResultedInChanges;
+            rw->syncTime = frameClock.nsecsElapsed() - syncStart;
+        }
+    }
+
+    for (int i = 0; i < renderOrder.size(); ++i) {
+        if (i > 0)
+            beginFrameTiming();
+        if (syncAndRender(&windows[renderOrder.at(i)]))
+            rendered = true;
+    }
+
+    // Without a swap to block on, throttle to the refresh rate so that
+    // the GUI thread does not sync faster than it would otherwise.
+    if (synced && !rendered) {
+        int waitTime = vsyncDelta - (int) waitTimer.elapsed();
+        if (waitTime > 0)
+            msleep(waitTime);
+    }
+}
+
+/*
+    Collects the animation controllers of all windows using this thread,
+    including obscured ones whose animators are still registered with the
+    driver. Must only be called while the GUI is blocked.
+ */
+void QSGRenderThread::updateAnimationControllers()
+{
+    animationControllers.clear();
+    for (const QSGThreadedRenderLoop::Window &w : qAsConst(wm->m_windows)) {
+        if (w.thread == this)
+            animationControllers << QQuickWindowPrivate::get(w.window)->animationController;
+    }
+}
+
+/*
+    The animator driver ticks the animators of all windows on this thread,
+    so lock all their controllers while it advances. The controllers are
+    collected during sync() since the window list belongs to the GUI thread.
+ */
+void QSGRenderThread::advanceAnimators()
+{
+    for (QQuickAnimatorController *controller : qAsConst(animationControllers))
+        controller->lock();
+    animatorDriver->advance();
+    for (QQuickAnimatorController *controller : qAsConst(animationControllers))
+        controller->unlock();
+}
+
+/*
+    Starts timing a frame for the profiler and the render loop timing log.
+ */
+void QSGRenderThread::beginFrameTiming()
+{
+    if (QSG_LOG_TIME_RENDERLOOP().isDebugEnabled()) {
         sinceLastTime = threadTimer.nsecsElapsed();
         threadTimer.start();
     }
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphRenderLoopFrame);
+}
 
-    QElapsedTimer waitTimer;
-    waitTimer.start();
+/*
+    Renders the window's frame after renderWindows() has synced it, or syncs
+    it first when it is being exposed. Returns false if nothing changed and
+    rendering was skipped.
+ */
+bool QSGRenderThread::syncAndRender(RenderWindow *rw)
+{
+    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
 
     qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "syncAndRender()");
 
-    syncResultedInChanges = false;
+    QQuickWindow *window = rw->window;
     QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
 
-    bool repaintRequested = (pendingUpdate & RepaintRequest) || d->customRenderStage;
-    bool syncRequested = pendingUpdate & SyncRequest;
-    bool exposeRequested = (pendingUpdate & ExposeRequest) == ExposeRequest;
-    pendingUpdate = 0;
+    bool repaintRequested = (rw->frameUpdate & RepaintRequest) || d->customRenderStage;
+    bool exposeRequested = (rw->frameUpdate & ExposeRequest) == ExposeRequest;
 
-    if (syncRequested) {
+    if (exposeRequested) {
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- updatePending, doing sync");
-        sync(exposeRequested);
+        const qint64 syncStart = frameClock.nsecsElapsed();
+        syncResultedInChanges = false;
+        sync(rw, true);
+        rw->syncResultedInChanges = syncResultedInChanges;
+        rw->syncTime = frameClock.nsecsElapsed() - syncStart;
     }
 #ifndef QSG_NO_RENDER_TIMING
     if (profileFrames)
@@ -615,25 +810,21 @@ void QSGRenderThread::syncAndRender()
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopSync);
 
-    if (!syncResultedInChanges && !repaintRequested && sgrc->isValid()) {
+    if (!rw->syncResultedInChanges && !repaintRequested && sgrc->isValid()) {
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- no changes, render aborted");
-        int waitTime = vsyncDelta - (int) waitTimer.elapsed();
-        if (waitTime > 0)
-            msleep(waitTime);
-        return;
+        return false;
     }
 
     qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- rendering started");
 
 
-    if (animatorDriver->isRunning()) {
-        d->animationController->lock();
-        animatorDriver->advance();
-        d->animationController->unlock();
+    if (animatorDriver->isRunning() && !animatorsAdvanced) {
+        advanceAnimators();
+        animatorsAdvanced = true;
     }
 
     bool current = false;
-    if (d->renderer && windowSize.width() > 0 && windowSize.height() > 0)
+    if (d->renderer && rw->size.width() > 0 && rw->size.height() > 0)
         current = gl->makeCurrent(window);
     // Check for context loss.
     if (!current && !gl->isValid()) {
@@ -642,13 +833,26 @@ void QSGRenderThread::syncAndRender()
         QCoreApplication::postEvent(window, new QEvent(QEvent::Type(QQuickWindowPrivate::FullUpdateRequest)));
     }
     if (current) {
-        d->renderSceneGraph(windowSize);
+        d->renderSceneGraph(rw->size);
         if (profileFrames)
             renderTime = threadTimer.nsecsElapsed();
         Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                                   QQuickProfiler::SceneGraphRenderLoopRender);
+        const qint64 swapStart = frameClock.nsecsElapsed();
         if (!d->customRenderStage || !d->customRenderStage->swap())
             gl->swapBuffers(window);
+        const qint64 swapEnd = frameClock.nsecsElapsed();
+
+        QQuickWindowFrameTiming timing;
+        timing.frameInterval = rw->lastSwapTime >= 0 ? swapEnd - rw->lastSwapTime : 0;
+        timing.syncTime = rw->syncTime;
+        timing.swapTime = swapEnd - swapStart;
+        timing.renderThreadWindows = windows.size();
+        rw->lastSwapTime = swapEnd;
+        {
+            QMutexLocker locker(&d->rendererStatisticsMutex);
+            d->frameTiming = timing;
+        }
         d->fireFrameSwapped();
     } else {
         Q_QUICK_SG_PROFILE_SKIP(QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -679,6 +883,7 @@ void QSGRenderThread::syncAndRender()
 
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
                            QQuickProfiler::SceneGraphRenderLoopSwap);
+    return true;
 }
 
 
@@ -723,16 +928,13 @@ void QSGRenderThread::run()
 
     while (active) {
 
-        if (window) {
-            if (!sgrc->openglContext() && windowSize.width() > 0 && windowSize.height() > 0 && gl->makeCurrent(window))
-                sgrc->initialize(gl);
-            syncAndRender();
-        }
+        if (!windows.isEmpty())
+            renderWindows();
 
         processEvents();
         QCoreApplication::processEvents();
 
-        if (active && (pendingUpdate == 0 || !window)) {
+        if (active && !hasPendingUpdates()) {
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "done drawing, sleep...");
             sleeping = true;
             processEventsAndWaitForMore();
@@ -753,12 +955,17 @@ void QSGRenderThread::run()
 
 QSGThreadedRenderLoop::QSGThreadedRenderLoop()
     : sg(QSGContext::createDefaultContext())
+    , m_nextRenderThread(0)
+    , m_renderThreadCount(qEnvironmentVariableIntValue("QSG_RENDER_THREADS"))
     , m_animation_timer(0)
 {
 #if defined(QSG_RENDER_LOOP_DEBUG)
     qsgrl_timer.start();
 #endif
 
+    if (m_renderThreadCount > 0)
+        qCDebug(QSG_LOG_RENDERLOOP, "- sharing %d render thread(s) between windows", m_renderThreadCount);
+
     m_animation_driver = sg->createAnimationDriver(this);
 
     connect(m_animation_driver, SIGNAL(started()), this, SLOT(animationStarted()));
@@ -769,12 +976,41 @@ QSGThreadedRenderLoop::QSGThreadedRenderLoop()
 
 QSGThreadedRenderLoop::~QSGThreadedRenderLoop()
 {
+    for (QSGRenderThread *thread : qAsConst(m_renderThreads)) {
+        if (!thread->isRunning())
+            delete thread;
+    }
     delete sg;
 }
 
 QSGRenderContext *QSGThreadedRenderLoop::createRenderContext(QSGContext *sg) const
 {
-    return sg->createRenderContext();
+    if (m_renderThreadCount <= 0)
+        return sg->createRenderContext();
+
+    // Windows get the render context of the shared thread that will render
+    // them, so that they share its atlases and glyph caches.
+    const int index = m_nextRenderThread;
+    m_nextRenderThread = (m_nextRenderThread + 1) % m_renderThreadCount;
+    if (index == m_renderThreads.size()) {
+        QSGThreadedRenderLoop *that = const_cast<QSGThreadedRenderLoop *>(this);
+        m_renderThreads << new QSGRenderThread(that, sg->createRenderContext());
+    }
+    return m_renderThreads.at(index)->sgrc;
+}
+
+/*
+    Returns the shared render thread owning the window's render context, or
+    a new thread for the window when threads are not shared.
+ */
+QSGRenderThread *QSGThreadedRenderLoop::renderThreadFor(QQuickWindow *window)
+{
+    QSGRenderContext *rc = QQuickWindowPrivate::get(window)->context;
+    for (QSGRenderThread *thread : qAsConst(m_renderThreads)) {
+        if (thread->sgrc == rc)
+            return thread;
+    }
+    return new QSGRenderThread(this, rc);
 }
 
 void QSGThreadedRenderLoop::maybePostPolishRequest(Window *w)
@@ -886,11 +1122,14 @@ void QSGThreadedRenderLoop::windowDestroyed(QQuickWindow *window)
     handleObscurity(w);
     releaseResources(w, true);
 
+    // Shared threads are kept for the other windows using their render context
     QSGRenderThread *thread = w->thread;
-    while (thread->isRunning())
-        QThread::yieldCurrentThread();
-    Q_ASSERT(thread->thread() == QThread::currentThread());
-    delete thread;
+    if (!m_renderThreads.contains(thread)) {
+        while (thread->isRunning())
+            QThread::yieldCurrentThread();
+        Q_ASSERT(thread->thread() == QThread::currentThread());
+        delete thread;
+    }
 
     for (int i=0; i<m_windows.size(); ++i) {
         if (m_windows.at(i).window == window) {
@@ -934,16 +1173,21 @@ void QSGThreadedRenderLoop::handleExposure(QQuickWindow *window)
         Window win;
         win.window = window;
         win.actualWindowFormat = window->format();
-        win.thread = new QSGRenderThread(this, QQuickWindowPrivate::get(window)->context);
+        win.thread = renderThreadFor(window);
         win.updateDuringSync = false;
         win.forceRenderPass = true; // also covered by polishAndSync(inExpose=true), but doesn't hurt
+        win.exposed = false;
         m_windows << win;
         w = &m_windows.last();
+
+        // Joining a shared thread which already has an OpenGL context
+        if (w->thread->gl)
+            QQuickWindowPrivate::get(window)->fireOpenGLContextCreated(w->thread->gl);
     }
 
     // set this early as we'll be rendering shortly anyway and this avoids
     // specialcasing exposure in polishAndSync.
-    w->thread->window = window;
+    w->exposed = true;
 
     if (w->window->width() <= 0 || w->window->height() <= 0
         || (w->window->isTopLevel() && !w->window->geometry().intersects(w->window->screen()->availableGeometry()))) {
@@ -984,10 +1228,6 @@ void QSGThreadedRenderLoop::handleExposure(QQuickWindow *window)
             qCDebug(QSG_LOG_RENDERLOOP, "- OpenGL context created");
         }
 
-        QQuickAnimatorController *controller = QQuickWindowPrivate::get(w->window)->animationController;
-        if (controller->thread() != w->thread)
-            controller->moveToThread(w->thread);
-
         w->thread->active = true;
         if (w->thread->thread() == QThread::currentThread()) {
             w->thread->sgrc->moveToThread(w->thread);
@@ -1001,6 +1241,10 @@ void QSGThreadedRenderLoop::handleExposure(QQuickWindow *window)
         qCDebug(QSG_LOG_RENDERLOOP, "- render thread already running");
     }
 
+    QQuickAnimatorController *controller = QQuickWindowPrivate::get(w->window)->animationController;
+    if (controller->thread() != w->thread)
+        controller->moveToThread(w->thread);
+
     polishAndSync(w, true);
     qCDebug(QSG_LOG_RENDERLOOP, "- done with handleExposure()");
 
@@ -1023,6 +1267,7 @@ void QSGThreadedRenderLoop::handleObscurity(Window *w)
         w->thread->waitCondition.wait(&w->thread->mutex);
         w->thread->mutex.unlock();
     }
+    w->exposed = false;
     startOrStopAnimationTimer();
 }
 
@@ -1086,7 +1331,7 @@ void QSGThreadedRenderLoop::update(QQuickWindow *window)
 
     if (w->thread == QThread::currentThread()) {
         qCDebug(QSG_LOG_RENDERLOOP) << "update on window - on render thread" << w->window;
-        w->thread->requestRepaint();
+        w->thread->requestRepaint(window);
         return;
     }
 
@@ -1160,7 +1405,7 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     qCDebug(QSG_LOG_RENDERLOOP) << "polishAndSync" << (inExpose ? "(in expose)" : "(normal)") << w->window;
 
     QQuickWindow *window = w->window;
-    if (!w->thread || !w->thread->window) {
+    if (!w->thread || !w->exposed) {
         qCDebug(QSG_LOG_RENDERLOOP, "- not exposed, abort");
         return;
     }
@@ -1169,7 +1414,7 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     QQuickWindowPrivate::get(window)->flushFrameSynchronousEvents();
     // The delivery of the event might have caused the window to stop rendering
     w = windowFor(m_windows, window);
-    if (!w || !w->thread || !w->thread->window) {
+    if (!w || !w->thread || !w->exposed) {
         qCDebug(QSG_LOG_RENDERLOOP, "- removed after event flushing, abort");
         return;
     }
@@ -1311,7 +1556,7 @@ QImage QSGThreadedRenderLoop::grab(QQuickWindow *window)
 void QSGThreadedRenderLoop::postJob(QQuickWindow *window, QRunnable *job)
 {
     Window *w = windowFor(m_windows, window);
-    if (w && w->thread && w->thread->window)
+    if (w && w->thread && w->exposed)
         w->thread->postEvent(new WMJobEvent(window, job));
     else
         delete job;
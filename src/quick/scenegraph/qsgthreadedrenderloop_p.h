@@ -103,6 +103,7 @@ private:
         QSurfaceFormat actualWindowFormat;
         uint updateDuringSync : 1;
         uint forceRenderPass : 1;
+        uint exposed : 1;
     };
 
     friend class QSGRenderThread;
@@ -122,11 +123,17 @@ private:
     void handleExposure(QQuickWindow *w);
     void handleObscurity(Window *w);
 
+    QSGRenderThread *renderThreadFor(QQuickWindow *window);
 
     QSGContext *sg;
     QAnimationDriver *m_animation_driver;
     QList<Window> m_windows;
 
+    // Render threads shared between windows, see QSG_RENDER_THREADS
+    mutable QList<QSGRenderThread *> m_renderThreads;
+    mutable int m_nextRenderThread;
+    int m_renderThreadCount;
+
     int m_animation_timer;
 
     bool m_lockedForSync;
@@ -4,6 +4,7 @@
 HEADERS += \
     $$PWD/coreapi/qsggeometry.h \
     $$PWD/coreapi/qsgmaterial.h \
+    $$PWD/coreapi/qsgmaterial_p.h \
     $$PWD/coreapi/qsgmaterialshader_p.h \
     $$PWD/coreapi/qsgnode.h \
     $$PWD/coreapi/qsgnode_p.h \
@@ -37,6 +38,7 @@ qtConfig(opengl(es1|es2)?) {
 # Util API
 HEADERS += \
     $$PWD/util/qsgareaallocator_p.h \
+    $$PWD/util/qsgdistancefieldglyphstore_p.h \
     $$PWD/util/qsgengine.h \
     $$PWD/util/qsgengine_p.h \
     $$PWD/util/qsgsimplerectnode.h \
@@ -55,6 +57,7 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/util/qsgareaallocator.cpp \
+    $$PWD/util/qsgdistancefieldglyphstore.cpp \
     $$PWD/util/qsgengine.cpp \
     $$PWD/util/qsgsimplerectnode.cpp \
     $$PWD/util/qsgsimpletexturenode.cpp \
@@ -0,0 +1,554 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qsgdistancefieldglyphstore_p.h"
+
+#include <QtQuick/private/qsgcontext_p.h>
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qsavefile.h>
+#include <QtGui/qpainterpath.h>
+#include <private/qrawfont_p.h>
+#include <private/qfontengine_p.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The store keeps generated distance fields outside of the per-context
+    glyph caches, so that they can be generated ahead of time on a worker
+    thread and, when QSG_DISTANCEFIELD_CACHE_DIR is set, be reused across
+    application runs.
+
+    Every font is written to its own file, named after the hex encoded
+    font key, containing a header followed by a compressed list of glyphs:
+
+        quint32 magic, quint32 version, QByteArray key,
+        qCompress([quint32 count, { quint32 glyph, quint16 w, quint16 h, w * h bytes }*])
+*/
+
+static const quint32 qsg_glyphstore_magic = 0x51534744; // "QSGD"
+static const quint32 qsg_glyphstore_version = 1;
+static const int qsg_glyphstore_prewarm_chunk = 64;
+// Glyphs added within this many milliseconds are written in one go
+static const unsigned long qsg_glyphstore_save_delay = 1000;
+// Even the widest glyphs stay well below 16 ems of the largest base font
+// size, so larger distance fields come from a damaged file
+static const int qsg_glyphstore_max_field_size = 16 * QT_DISTANCEFIELD_BASEFONTSIZE(true);
+
+Q_GLOBAL_STATIC(QSGDistanceFieldGlyphStore, qsg_distancefield_glyph_store)
+
+static QDistanceField qsg_createDistanceField(glyph_t glyph, int width, int height, const QByteArray &data)
+{
+    // QDistanceField cannot be given a glyph index after construction, so
+    // start from an empty field for the glyph and resize it by copying.
+    QDistanceField field = QDistanceField(QPainterPath(), glyph, false).copy(0, 0, width, height);
+    if (field.width() != width || field.height() != height)
+        return QDistanceField();
+    memcpy(field.bits(), data.constData(), width * height);
+    return field;
+}
+
+class QSGDistanceFieldGlyphStore::Job : public QRunnable
+{
+public:
+    Job(const std::function<void ()> &function) : m_function(function) { }
+    void run() override { m_function(); }
+
+private:
+    std::function<void ()> m_function;
+};
+
+QSGDistanceFieldGlyphStore::QSGDistanceFieldGlyphStore()
+    : m_savePending(false)
+    , m_saveFlushes(0)
+{
+    // A pending save waits in a thread of the pool, don't let it hold up prewarming
+    m_pool.setMaxThreadCount(m_pool.maxThreadCount() + 1);
+
+    const QString dir = qEnvironmentVariable("QSG_DISTANCEFIELD_CACHE_DIR");
+    if (!dir.isEmpty())
+        setCacheDirectory(dir);
+}
+
+QSGDistanceFieldGlyphStore::~QSGDistanceFieldGlyphStore()
+{
+    waitForDone();
+    save();
+}
+
+/*
+    Returns the store shared by all distance field glyph caches in the process.
+ */
+QSGDistanceFieldGlyphStore *QSGDistanceFieldGlyphStore::instance()
+{
+    return qsg_distancefield_glyph_store();
+}
+
+/*
+    Returns a key identifying the distance fields generated for \a font.
+
+    The key is built from the font data rather than the file name, so that
+    a persistent store is not reused after the font file has changed. The
+    parameters used for generating the distance fields are part of the key.
+ */
+QByteArray QSGDistanceFieldGlyphStore::fontKey(const QRawFont &font)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    // The checksum adjustment in the 'head' table covers the whole font file.
+    const QByteArray head = font.fontTable("head");
+    if (!head.isEmpty()) {
+        hash.addData(head);
+        hash.addData(font.fontTable("maxp"));
+        hash.addData(font.fontTable("name"));
+    } else {
+        const QFontEngine::FaceId faceId = QRawFontPrivate::get(font)->fontEngine->faceId();
+        QFile file(QFile::decodeName(faceId.filename));
+        if (faceId.filename.isEmpty() || !file.open(QIODevice::ReadOnly) || !hash.addData(&file))
+            hash.addData(font.familyName().toUtf8() + '_' + font.styleName().toUtf8());
+        hash.addData(QByteArray::number(faceId.index));
+    }
+
+    const bool doubleResolution = doubleGlyphResolution(font);
+    hash.addData(QByteArray::number(font.style()) + '_'
+                 + QByteArray::number(font.weight()) + '_'
+                 + QByteArray::number(doubleResolution) + '_'
+                 + QByteArray::number(QT_DISTANCEFIELD_BASEFONTSIZE(doubleResolution)) + '_'
+                 + QByteArray::number(QT_DISTANCEFIELD_SCALE(doubleResolution)) + '_'
+                 + QByteArray::number(QT_DISTANCEFIELD_RADIUS(doubleResolution)));
+
+    return hash.result();
+}
+
+/*
+    Returns whether distance fields for \a font are generated at double
+    resolution. This matches the choice made by QSGDistanceFieldGlyphCache.
+ */
+bool QSGDistanceFieldGlyphStore::doubleGlyphResolution(const QRawFont &font)
+{
+    const int glyphCount = QRawFontPrivate::get(font)->fontEngine->glyphCount();
+    return qt_fontHasNarrowOutlines(font) && glyphCount < QT_DISTANCEFIELD_HIGHGLYPHCOUNT();
+}
+
+QString QSGDistanceFieldGlyphStore::cacheDirectory() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_cacheDirectory;
+}
+
+/*
+    Sets the directory the store is persisted to to \a path, and starts
+    loading the glyphs stored there in the background. Glyphs already in the
+    store are written to the new directory. An empty \a path disables
+    persistence.
+ */
+void QSGDistanceFieldGlyphStore::setCacheDirectory(const QString &path)
+{
+    waitForDone();
+
+    QMutexLocker locker(&m_mutex);
+    if (m_cacheDirectory == path)
+        return;
+
+    m_cacheDirectory = path;
+    m_dirtyFonts.clear();
+    if (path.isEmpty())
+        return;
+
+    for (auto it = m_fonts.cbegin(), end = m_fonts.cend(); it != end; ++it)
+        m_dirtyFonts.insert(it.key());
+
+    m_pool.start(new Job([this]() { load(); }));
+    scheduleSave();
+}
+
+/*
+    Generates the distance fields for \a glyphs of \a font in the background.
+
+    The glyph outlines are extracted on the calling thread, since the font
+    engine is not thread-safe. Glyphs that are already in the store and
+    glyphs without outline are skipped.
+ */
+void QSGDistanceFieldGlyphStore::prewarm(const QRawFont &font, const QVector<quint32> &glyphs)
+{
+    if (!font.isValid() || glyphs.isEmpty())
+        return;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const QByteArray key = fontKey(font);
+    const bool doubleResolution = doubleGlyphResolution(font);
+
+    QSet<glyph_t> pending;
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto fields = m_fonts.constFind(key);
+        for (glyph_t glyph : glyphs) {
+            if (fields == m_fonts.cend() || !fields->contains(glyph))
+                pending.insert(glyph);
+        }
+    }
+
+    // Use the same pixel size as QSGDistanceFieldGlyphCache for the outlines
+    QRawFont referenceFont = font;
+    referenceFont.setPixelSize(QT_DISTANCEFIELD_BASEFONTSIZE(doubleResolution) * QT_DISTANCEFIELD_SCALE(doubleResolution));
+
+    GlyphPaths paths;
+    for (glyph_t glyph : qAsConst(pending)) {
+        const QPainterPath path = referenceFont.pathForGlyph(glyph);
+        if (path.boundingRect().isEmpty())
+            continue;
+        paths.append(qMakePair(glyph, path));
+        if (paths.size() == qsg_glyphstore_prewarm_chunk) {
+            m_pool.start(new Job([this, key, doubleResolution, paths]() { generate(key, doubleResolution, paths); }));
+            paths.clear();
+        }
+    }
+    if (!paths.isEmpty())
+        m_pool.start(new Job([this, key, doubleResolution, paths]() { generate(key, doubleResolution, paths); }));
+
+    QMutexLocker locker(&m_mutex);
+    m_statistics.prewarmTime += timer.elapsed();
+}
+
+/*
+    Blocks until all prewarming, loading and saving started so far is done.
+    Pending saves are written right away instead of after the usual delay.
+ */
+void QSGDistanceFieldGlyphStore::waitForDone()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        ++m_saveFlushes;
+        m_saveCondition.wakeAll();
+    }
+    m_pool.waitForDone();
+
+    QMutexLocker locker(&m_mutex);
+    --m_saveFlushes;
+}
+
+/*
+    Returns the distance field for \a glyph of the font identified by \a key,
+    or a null distance field if the store does not contain it.
+ */
+QDistanceField QSGDistanceFieldGlyphStore::find(const QByteArray &key, glyph_t glyph)
+{
+    QMutexLocker locker(&m_mutex);
+    const auto fields = m_fonts.constFind(key);
+    if (fields != m_fonts.cend()) {
+        const auto field = fields->constFind(glyph);
+        if (field != fields->cend()) {
+            ++m_statistics.storeHits;
+            return *field;
+        }
+    }
+    ++m_statistics.storeMisses;
+    return QDistanceField();
+}
+
+/*
+    Adds \a field, generated for the font identified by \a key, to the store
+    so that it is written to disk. Does nothing if persistence is disabled.
+
+    Writing is delayed a little, so that the glyphs added by the following
+    updates of the glyph caches are written together with this one.
+ */
+void QSGDistanceFieldGlyphStore::insert(const QByteArray &key, const QDistanceField &field)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_cacheDirectory.isEmpty())
+            return;
+    }
+    addFields(key, QVector<QDistanceField>() << field);
+}
+
+/*
+    Writes the fonts changed since the last save to the cache directory.
+    Glyphs stored in the existing files are kept, so that processes sharing
+    a directory do not drop each other's glyphs.
+ */
+void QSGDistanceFieldGlyphStore::save()
+{
+    QMutexLocker saveLocker(&m_saveMutex);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QString dir;
+    QHash<QByteArray, GlyphFields> dirtyFonts;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_savePending = false;
+        if (m_cacheDirectory.isEmpty() || m_dirtyFonts.isEmpty())
+            return;
+        dir = m_cacheDirectory;
+        for (const QByteArray &key : qAsConst(m_dirtyFonts))
+            dirtyFonts.insert(key, m_fonts.value(key));
+        m_dirtyFonts.clear();
+    }
+
+    if (!QDir().mkpath(dir)) {
+        qWarning("QSGDistanceFieldGlyphStore: Unable to create cache directory %s", qPrintable(dir));
+        return;
+    }
+
+    int count = 0;
+    for (auto it = dirtyFonts.begin(), end = dirtyFonts.end(); it != end; ++it) {
+        const QString fileName = dir + QLatin1Char('/') + QString::fromLatin1(it.key().toHex())
+                + QLatin1String(".qsgdf");
+
+        QByteArray fileKey;
+        GlyphFields fileFields;
+        if (readFile(fileName, &fileKey, &fileFields) && fileKey == it.key()) {
+            for (auto field = fileFields.cbegin(), fieldsEnd = fileFields.cend(); field != fieldsEnd; ++field) {
+                if (!it->contains(field.key()))
+                    it->insert(field.key(), field.value());
+            }
+        }
+
+        if (writeFile(fileName, it.key(), *it))
+            count += it->size();
+        else
+            qWarning("QSGDistanceFieldGlyphStore: Unable to write %s", qPrintable(fileName));
+    }
+
+    const qint64 elapsed = timer.elapsed();
+    {
+        QMutexLocker locker(&m_mutex);
+        m_statistics.savedGlyphs += count;
+        m_statistics.saveTime += elapsed;
+    }
+
+    qCDebug(QSG_LOG_TIME_GLYPH, "distancefield: %d glyphs saved in %dms", count, int(elapsed));
+}
+
+QSGDistanceFieldGlyphStore::Statistics QSGDistanceFieldGlyphStore::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+void QSGDistanceFieldGlyphStore::generate(const QByteArray &key, bool doubleResolution, const GlyphPaths &paths)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector<QDistanceField> fields;
+    fields.reserve(paths.size());
+    for (const auto &path : paths)
+        fields.append(QDistanceField(path.second, path.first, doubleResolution));
+
+    addFields(key, fields);
+
+    const qint64 elapsed = timer.elapsed();
+    {
+        QMutexLocker locker(&m_mutex);
+        m_statistics.prewarmedGlyphs += fields.size();
+        m_statistics.prewarmTime += elapsed;
+    }
+
+    qCDebug(QSG_LOG_TIME_GLYPH, "distancefield: %d glyphs prewarmed in %dms", fields.size(), int(elapsed));
+}
+
+void QSGDistanceFieldGlyphStore::addFields(const QByteArray &key, const QVector<QDistanceField> &fields)
+{
+    QMutexLocker locker(&m_mutex);
+    GlyphFields &glyphs = m_fonts[key];
+    for (const QDistanceField &field : fields)
+        glyphs.insert(field.glyph(), field);
+
+    if (!m_cacheDirectory.isEmpty()) {
+        m_dirtyFonts.insert(key);
+        scheduleSave();
+    }
+}
+
+// Must be called with m_mutex locked
+void QSGDistanceFieldGlyphStore::scheduleSave()
+{
+    if (m_savePending)
+        return;
+    m_savePending = true;
+    m_pool.start(new Job([this]() {
+        {
+            QMutexLocker locker(&m_mutex);
+            if (!m_saveFlushes)
+                m_saveCondition.wait(&m_mutex, qsg_glyphstore_save_delay);
+        }
+        save();
+    }));
+}
+
+void QSGDistanceFieldGlyphStore::load()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const QString dir = cacheDirectory();
+    if (dir.isEmpty())
+        return;
+
+    const QStringList files = QDir(dir).entryList(QStringList() << QStringLiteral("*.qsgdf"), QDir::Files);
+
+    int count = 0;
+    for (const QString &file : files) {
+        QByteArray key;
+        GlyphFields fields;
+        if (!readFile(dir + QLatin1Char('/') + file, &key, &fields))
+            continue;
+
+        QMutexLocker locker(&m_mutex);
+        GlyphFields &glyphs = m_fonts[key];
+        for (auto it = fields.cbegin(), end = fields.cend(); it != end; ++it) {
+            if (!glyphs.contains(it.key())) {
+                glyphs.insert(it.key(), it.value());
+                ++count;
+            }
+        }
+    }
+
+    const qint64 elapsed = timer.elapsed();
+    {
+        QMutexLocker locker(&m_mutex);
+        m_statistics.loadedGlyphs += count;
+        m_statistics.loadTime += elapsed;
+    }
+
+    qCDebug(QSG_LOG_TIME_GLYPH, "distancefield: %d glyphs loaded from %s in %dms",
+            count, qPrintable(dir), int(elapsed));
+}
+
+bool QSGDistanceFieldGlyphStore::readFile(const QString &fileName, QByteArray *key, GlyphFields *fields)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_11);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray compressed;
+    stream >> magic >> version;
+    if (magic != qsg_glyphstore_magic || version != qsg_glyphstore_version)
+        return false;
+    stream >> *key >> compressed;
+    if (stream.status() != QDataStream::Ok || compressed.size() < 4)
+        return false;
+
+    // qUncompress() allocates the size given in the first four bytes, which
+    // can't be more than zlib's maximum compression ratio of 1032:1 allows.
+    const quint32 uncompressedSize = (quint32(uchar(compressed.at(0))) << 24)
+            | (quint32(uchar(compressed.at(1))) << 16)
+            | (quint32(uchar(compressed.at(2))) << 8)
+            | quint32(uchar(compressed.at(3)));
+    if (uncompressedSize / 1032 > quint32(compressed.size()))
+        return false;
+
+    const QByteArray data = qUncompress(compressed);
+    QDataStream glyphStream(data);
+    glyphStream.setVersion(QDataStream::Qt_5_11);
+
+    quint32 count = 0;
+    glyphStream >> count;
+    for (quint32 i = 0; i < count; ++i) {
+        quint32 glyph = 0;
+        quint16 width = 0;
+        quint16 height = 0;
+        glyphStream >> glyph >> width >> height;
+        if (glyphStream.status() != QDataStream::Ok
+                || width > qsg_glyphstore_max_field_size
+                || height > qsg_glyphstore_max_field_size) {
+            return false;
+        }
+        const int size = int(width) * int(height);
+        if (size > data.size() - glyphStream.device()->pos())
+            return false;
+        QByteArray bits(size, Qt::Uninitialized);
+        if (glyphStream.readRawData(bits.data(), size) != size)
+            return false;
+
+        const QDistanceField field = qsg_createDistanceField(glyph, width, height, bits);
+        if (!field.isNull())
+            fields->insert(glyph, field);
+    }
+
+    return true;
+}
+
+bool QSGDistanceFieldGlyphStore::writeFile(const QString &fileName, const QByteArray &key,
+                                           const GlyphFields &fields)
+{
+    QByteArray data;
+    {
+        QDataStream glyphStream(&data, QIODevice::WriteOnly);
+        glyphStream.setVersion(QDataStream::Qt_5_11);
+        glyphStream << quint32(fields.size());
+        for (const QDistanceField &field : fields) {
+            glyphStream << quint32(field.glyph()) << quint16(field.width()) << quint16(field.height());
+            glyphStream.writeRawData(reinterpret_cast<const char *>(field.constBits()),
+                                     field.width() * field.height());
+        }
+    }
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_11);
+    stream << qsg_glyphstore_magic << qsg_glyphstore_version << key << qCompress(data);
+    if (stream.status() != QDataStream::Ok)
+        return false;
+
+    return file.commit();
+}
+
+QT_END_NAMESPACE
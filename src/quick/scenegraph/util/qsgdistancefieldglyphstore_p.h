@@ -0,0 +1,129 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QSGDISTANCEFIELDGLYPHSTORE_P_H
+#define QSGDISTANCEFIELDGLYPHSTORE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qset.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtGui/qpainterpath.h>
+#include <QtGui/qrawfont.h>
+#include <QtGui/private/qdistancefield_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICK_PRIVATE_EXPORT QSGDistanceFieldGlyphStore
+{
+public:
+    struct Statistics {
+        int prewarmedGlyphs = 0;
+        qint64 prewarmTime = 0;
+        int loadedGlyphs = 0;
+        qint64 loadTime = 0;
+        int savedGlyphs = 0;
+        qint64 saveTime = 0;
+        int storeHits = 0;
+        int storeMisses = 0;
+    };
+
+    QSGDistanceFieldGlyphStore();
+    ~QSGDistanceFieldGlyphStore();
+
+    static QSGDistanceFieldGlyphStore *instance();
+
+    static QByteArray fontKey(const QRawFont &font);
+    static bool doubleGlyphResolution(const QRawFont &font);
+
+    QString cacheDirectory() const;
+    void setCacheDirectory(const QString &path);
+
+    void prewarm(const QRawFont &font, const QVector<quint32> &glyphs);
+    void waitForDone();
+
+    QDistanceField find(const QByteArray &key, glyph_t glyph);
+    void insert(const QByteArray &key, const QDistanceField &field);
+    void save();
+
+    Statistics statistics() const;
+
+private:
+    class Job;
+    typedef QHash<glyph_t, QDistanceField> GlyphFields;
+    typedef QVector<QPair<glyph_t, QPainterPath> > GlyphPaths;
+
+    void generate(const QByteArray &key, bool doubleResolution, const GlyphPaths &paths);
+    void addFields(const QByteArray &key, const QVector<QDistanceField> &fields);
+    void scheduleSave();
+    void load();
+
+    static bool readFile(const QString &fileName, QByteArray *key, GlyphFields *fields);
+    static bool writeFile(const QString &fileName, const QByteArray &key, const GlyphFields &fields);
+
+    mutable QMutex m_mutex;
+    QMutex m_saveMutex;
+    QString m_cacheDirectory;
+    QHash<QByteArray, GlyphFields> m_fonts;
+    QSet<QByteArray> m_dirtyFonts;
+    bool m_savePending;
+    int m_saveFlushes;
+    QWaitCondition m_saveCondition;
+    Statistics m_statistics;
+    QThreadPool m_pool;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSGDISTANCEFIELDGLYPHSTORE_P_H
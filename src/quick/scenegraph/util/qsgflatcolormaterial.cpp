@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qsgflatcolormaterial.h"
+#include <private/qsgmaterial_p.h>
 #include <private/qsgmaterialshader_p.h>
 #if QT_CONFIG(opengl)
 # include <qopenglshaderprogram.h>
@@ -150,6 +151,7 @@ void FlatColorMaterialShader::initialize()
 
 QSGFlatColorMaterial::QSGFlatColorMaterial() : m_color(QColor(255, 255, 255))
 {
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 
@@ -39,6 +39,7 @@
 
 #include "qsgtexturematerial_p.h"
 #include "qsgtexture_p.h"
+#include <private/qsgmaterial_p.h>
 #if QT_CONFIG(opengl)
 # include <QtGui/qopenglshaderprogram.h>
 # include <QtGui/qopenglfunctions.h>
@@ -175,6 +176,7 @@ QSGOpaqueTextureMaterial::QSGOpaqueTextureMaterial()
     , m_vertical_wrap(QSGTexture::ClampToEdge)
     , m_anisotropy_level(QSGTexture::AnisotropyNone)
 {
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qsgvertexcolormaterial.h"
+#include <private/qsgmaterial_p.h>
 #if QT_CONFIG(opengl)
 # include <qopenglshaderprogram.h>
 #endif
@@ -135,6 +136,7 @@ void QSGVertexColorMaterialShader::initialize()
 QSGVertexColorMaterial::QSGVertexColorMaterial()
 {
     setFlag(Blending, true);
+    QSGMaterialPrivate::setFlag(this, QSGMaterialPrivate::NoVertexDisplacement);
 }
 
 
@@ -0,0 +1,30 @@
+import QtQml 2.0
+
+QtObject {
+    id: root
+
+    signal triggered()
+
+    property int pingCount: 0
+    property int triggerCount: 0
+    property int oneShotCount: 0
+
+    property Component handlerComponent: Component {
+        QtObject {
+            signal ping()
+            onPing: root.pingCount++
+
+            property Connections connections: Connections {
+                target: root
+                onTriggered: root.triggerCount++
+            }
+            property Connections oneShot: Connections {
+                target: root
+                onTriggered: {
+                    root.oneShotCount++;
+                    target = null;
+                }
+            }
+        }
+    }
+}
@@ -55,6 +55,7 @@ private slots:
     void disabledAtStart();
     void clearImplicitTarget();
     void onWithoutASignal();
+    void recycledSignalHandlers();
 
 private:
     QQmlEngine engine;
@@ -407,6 +408,46 @@ void tst_qqmlconnections::onWithoutASignal()
     QVERIFY(item == nullptr); // should parse error, and not give us an item (or crash).
 }
 
+// Signal handlers are allocated from a pool owned by the engine; handlers of destroyed
+// objects are reused for the objects created next and must behave like new ones.
+void tst_qqmlconnections::recycledSignalHandlers()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("recycledHandlers.qml"));
+    QScopedPointer<QObject> root(c.create());
+    QVERIFY2(root, qPrintable(c.errorString()));
+    QQmlComponent *handlerComponent = qvariant_cast<QQmlComponent *>(root->property("handlerComponent"));
+    QVERIFY(handlerComponent);
+
+    const int objectCount = 20;
+    for (int round = 1; round <= 3; ++round) {
+        QList<QObject *> objects;
+        for (int i = 0; i < objectCount; ++i) {
+            QObject *object = handlerComponent->create();
+            QVERIFY2(object, qPrintable(handlerComponent->errorString()));
+            objects << object;
+        }
+
+        for (QObject *object : qAsConst(objects))
+            QVERIFY(QMetaObject::invokeMethod(object, "ping"));
+        QCOMPARE(root->property("pingCount").toInt(), round * objectCount);
+
+        // The one-shot handlers clear their target while being notified
+        QVERIFY(QMetaObject::invokeMethod(root.data(), "triggered"));
+        QVERIFY(QMetaObject::invokeMethod(root.data(), "triggered"));
+        QCOMPARE(root->property("triggerCount").toInt(), 2 * round * objectCount);
+        QCOMPARE(root->property("oneShotCount").toInt(), round * objectCount);
+
+        qDeleteAll(objects);
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        // Handlers of destroyed objects must not be called anymore
+        QVERIFY(QMetaObject::invokeMethod(root.data(), "triggered"));
+        QCOMPARE(root->property("triggerCount").toInt(), 2 * round * objectCount);
+        QCOMPARE(root->property("oneShotCount").toInt(), round * objectCount);
+    }
+}
+
 QTEST_MAIN(tst_qqmlconnections)
 
 #include "tst_qqmlconnections.moc"
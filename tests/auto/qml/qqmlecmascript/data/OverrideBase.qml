@@ -0,0 +1,8 @@
+import QtQml 2.0
+
+QtObject {
+    id: base
+    property int value: 1
+
+    function readValue(obj) { return obj.value; }
+}
@@ -0,0 +1,7 @@
+import QtQml 2.0
+
+OverrideBase {
+    property string value: "derived"
+
+    function readDerivedValue(obj) { return obj.value; }
+}
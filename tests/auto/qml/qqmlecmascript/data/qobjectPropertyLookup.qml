@@ -0,0 +1,40 @@
+import QtQml 2.0
+
+QtObject {
+    id: root
+
+    property QtObject first: QtObject {
+        property int value: 10
+        property string name: "first"
+    }
+    property QtObject second: QtObject {
+        property string name: "second"
+        property int value: 20
+    }
+    property QtObject third: QtObject {
+        property int value: 30
+    }
+
+    function readValue(obj) { return obj.value; }
+    function writeValue(obj, v) { obj.value = v; }
+
+    property int sum: 0
+    property bool writesOk: false
+
+    Component.onCompleted: {
+        var s = 0;
+        for (var i = 0; i < 10; ++i) {
+            s += readValue(first);
+            s += readValue(second);
+            s += readValue(third);
+            s += readValue({ value: 1 });
+        }
+        sum = s;
+
+        writeValue(first, 11);
+        writeValue(second, 21);
+        writeValue(first, 12);
+        writeValue(third, 31);
+        writesOk = first.value === 12 && second.value === 21 && third.value === 31;
+    }
+}
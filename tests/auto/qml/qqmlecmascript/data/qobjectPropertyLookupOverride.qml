@@ -0,0 +1,21 @@
+import QtQml 2.0
+
+QtObject {
+    property QtObject first: OverrideDerived {}
+    property QtObject second: OverrideDerived {}
+
+    property string result
+
+    Component.onCompleted: {
+        var values = [];
+        for (var i = 0; i < 3; ++i) {
+            // Same call site in the base type's context: the object's own base property
+            // is visible for itself, the overriding one for other objects.
+            values.push(first.readValue(second));
+            values.push(first.readValue(first));
+            // Call site in the derived type's context
+            values.push(first.readDerivedValue(first));
+        }
+        result = values.join(",");
+    }
+}
@@ -353,6 +353,8 @@ private slots:
     void anotherNaN();
     void callPropertyOnUndefined();
     void jumpStrictNotEqualUndefined();
+    void qobjectPropertyLookup();
+    void qobjectPropertyLookupOverride();
 
 private:
 //    static void propertyVarWeakRefCallback(v8::Persistent<v8::Value> object, void* parameter);
@@ -8513,6 +8515,28 @@ void tst_qqmlecmascript::jumpStrictNotEqualUndefined()
     QCOMPARE(v.toInt(), 2);
 }
 
+// Property lookups on QObjects are cached per property cache; make sure the cached lookups
+// fall back correctly when objects of different types pass through the same call site.
+void tst_qqmlecmascript::qobjectPropertyLookup()
+{
+    QQmlComponent component(&engine, testFileUrl("qobjectPropertyLookup.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+    QCOMPARE(object->property("sum").toInt(), 610);
+    QVERIFY(object->property("writesOk").toBool());
+}
+
+// Which of several properties with the same name a lookup resolves to depends on the
+// calling context; such lookups must not be cached by property cache alone.
+void tst_qqmlecmascript::qobjectPropertyLookupOverride()
+{
+    QQmlComponent component(&engine, testFileUrl("qobjectPropertyLookupOverride.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+    QCOMPARE(object->property("result").toString(),
+             QStringLiteral("derived,1,derived,derived,1,derived,derived,1,derived"));
+}
+
 QTEST_MAIN(tst_qqmlecmascript)
 
 #include "tst_qqmlecmascript.moc"
@@ -0,0 +1,12 @@
+import QtQml 2.0
+import Qt.test 1.0
+
+QtObject {
+    property list<QtObject> callbacks: [
+        FinalizeCallback {},
+        FinalizeCallback {},
+        FinalizeCallback {},
+        FinalizeCallback {},
+        FinalizeCallback {}
+    ]
+}
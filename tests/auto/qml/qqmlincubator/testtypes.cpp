@@ -27,6 +27,7 @@
 ****************************************************************************/
 #include "testtypes.h"
 #include <QtQml/qqml.h>
+#include <private/qqmlengine_p.h>
 
 SelfRegisteringType *SelfRegisteringType::m_me = nullptr;
 SelfRegisteringType::SelfRegisteringType()
@@ -134,6 +135,25 @@ void CompletionCallbackType::registerCallback(callback c, void *d)
     m_data = d;
 }
 
+int FinalizeCallbackType::finalizedCount = 0;
+FinalizeCallbackType::FinalizeCallbackType()
+{
+}
+
+void FinalizeCallbackType::classBegin()
+{
+    QQmlEnginePrivate::get(qmlEngine(this))->registerFinalizeCallback(this, metaObject()->indexOfSlot("componentFinalized()"));
+}
+
+void FinalizeCallbackType::componentComplete()
+{
+}
+
+void FinalizeCallbackType::componentFinalized()
+{
+    ++finalizedCount;
+}
+
 void registerTypes()
 {
     qmlRegisterType<SelfRegisteringType>("Qt.test", 1,0, "SelfRegistering");
@@ -141,4 +161,5 @@ void registerTypes()
     qmlRegisterType<CompletionRegisteringType>("Qt.test", 1,0, "CompletionRegistering");
     qmlRegisterType<CallbackRegisteringType>("Qt.test", 1,0, "CallbackRegistering");
     qmlRegisterType<CompletionCallbackType>("Qt.test", 1,0, "CompletionCallback");
+    qmlRegisterType<FinalizeCallbackType>("Qt.test", 1,0, "FinalizeCallback");
 }
@@ -128,6 +128,22 @@ private:
     static void *m_data;
 };
 
+class FinalizeCallbackType : public QObject, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+public:
+    FinalizeCallbackType();
+
+    virtual void classBegin();
+    virtual void componentComplete();
+
+    static int finalizedCount;
+
+private slots:
+    void componentFinalized();
+};
+
 void registerTypes();
 
 #endif // TESTTYPES_H
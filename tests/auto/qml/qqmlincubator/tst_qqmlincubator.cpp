@@ -68,6 +68,7 @@ private slots:
     void chainedAsynchronousClear();
     void selfDelete();
     void contextDelete();
+    void interruptFinalizeCallbacks();
 
 private:
     QQmlIncubationController controller;
@@ -1144,6 +1145,34 @@ void tst_qqmlincubator::contextDelete()
     }
 }
 
+// Finalize callbacks, as registered by Behavior and animations, must not all be run
+// in the same incubation step.
+void tst_qqmlincubator::interruptFinalizeCallbacks()
+{
+    FinalizeCallbackType::finalizedCount = 0;
+
+    QQmlComponent component(&engine, testFileUrl("finalizeCallbacks.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    QQmlIncubator incubator;
+    component.create(incubator);
+    QVERIFY(incubator.isLoading());
+
+    int steps = 0;
+    while (incubator.isLoading()) {
+        const int finalized = FinalizeCallbackType::finalizedCount;
+        bool b = false;
+        controller.incubateWhile(&b);
+        QVERIFY(FinalizeCallbackType::finalizedCount - finalized <= 1);
+        QVERIFY(++steps < 100);
+    }
+
+    QVERIFY(incubator.isReady());
+    QCOMPARE(FinalizeCallbackType::finalizedCount, 5);
+    QVERIFY(steps > 5);
+    delete incubator.object();
+}
+
 QTEST_MAIN(tst_qqmlincubator)
 
 #include "tst_qqmlincubator.moc"
@@ -139,6 +139,7 @@ private slots:
     void find();
     void findInsertPosition_data();
     void findInsertPosition();
+    void findLongDistance();
     void insert();
     void clearFlags_data();
     void clearFlags();
@@ -1720,6 +1721,53 @@ void tst_qqmllistcompositor::groupDebug()
     qDebug() << Selection;
 }
 
+void tst_qqmllistcompositor::findLongDistance()
+{
+    int listA; void *a = &listA;
+
+    // Enough ranges that find() skips ahead using checkpoints rather than walking.
+    QQmlListCompositor compositor;
+    compositor.setGroupCount(4);
+    compositor.setDefaultGroups(VisibleFlag | C::DefaultFlag);
+
+    QVector<int> defaultIndexes;
+    int index = 0;
+    for (int i = 0; i < 2000; ++i) {
+        const int count = 1 + i % 3;
+        const bool visible = i % 2 == 0;
+        compositor.append(a, index, count, visible ? (VisibleFlag | C::DefaultFlag) : C::DefaultFlag);
+        if (visible) {
+            for (int j = 0; j < count; ++j)
+                defaultIndexes.append(index + j);
+        }
+        index += count;
+    }
+
+    QCOMPARE(compositor.count(Visible), defaultIndexes.count());
+
+    for (int i = 0; i < defaultIndexes.count(); ++i) {
+        const int visibleIndex = (i * 7919) % defaultIndexes.count();
+        QQmlListCompositor::iterator it = compositor.find(Visible, visibleIndex);
+        QCOMPARE(it.index[Visible], visibleIndex);
+        QCOMPARE(it.index[C::Default], defaultIndexes.at(visibleIndex));
+        QCOMPARE(it.modelIndex(), defaultIndexes.at(visibleIndex));
+    }
+
+    // Modifying the compositor must not leave stale checkpoints behind.
+    compositor.clearFlags(Visible, 0, defaultIndexes.count() / 2, VisibleFlag);
+    defaultIndexes.remove(0, defaultIndexes.count() / 2);
+    QCOMPARE(compositor.count(Visible), defaultIndexes.count());
+
+    for (int i = defaultIndexes.count() - 1; i >= 0; i -= 97) {
+        QQmlListCompositor::iterator it = compositor.find(Visible, i);
+        QCOMPARE(it.index[Visible], i);
+        QCOMPARE(it.index[C::Default], defaultIndexes.at(i));
+
+        QQmlListCompositor::insert_iterator insertIt = compositor.findInsertPosition(Visible, i);
+        QCOMPARE(insertIt.index[Visible], i);
+    }
+}
+
 QTEST_MAIN(tst_qqmllistcompositor)
 
 #include "tst_qqmllistcompositor.moc"
@@ -126,6 +126,8 @@ private slots:
     void stringifyModelEntry();
     void qobjectTrackerForDynamicModelObjects();
     void crash_append_empty_array();
+    void insertArray();
+    void setArray();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -1556,6 +1558,76 @@ void tst_qqmllistmodel::crash_append_empty_array()
     QCOMPARE(spy.count(), 0);
 }
 
+void tst_qqmllistmodel::insertArray()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(
+                "import QtQuick 2.0\n"
+                "ListModel {\n"
+                "   ListElement { name: \"first\" }\n"
+                "   ListElement { name: \"last\" }\n"
+                "}\n", QUrl());
+    QScopedPointer<QQmlListModel> model(qobject_cast<QQmlListModel *>(component.create()));
+    QVERIFY(model);
+
+    QQmlExpression lastExpr(engine.rootContext(), model.data(), "get(1)");
+    QObject *last = lastExpr.evaluate().value<QObject *>();
+    QVERIFY(last);
+
+    QSignalSpy spy(model.data(), &QQmlListModel::rowsInserted);
+    QQmlExpression expr(engine.rootContext(), model.data(),
+                        "insert(1, [{name: \"same\"}, {name: \"same\"}, {name: \"same\"}])");
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), QTest::toString(expr.error().toString()));
+
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(model->count(), 5);
+    QCOMPARE(last->property("name").toString(), QString("last"));
+    QCOMPARE(model->data(model->index(4, 0), 0).toString(), QString("last"));
+
+    // Equal values share their storage, changing one must not affect the others.
+    model->setProperty(2, "name", "changed");
+    QCOMPARE(model->data(model->index(1, 0), 0).toString(), QString("same"));
+    QCOMPARE(model->data(model->index(2, 0), 0).toString(), QString("changed"));
+    QCOMPARE(model->data(model->index(3, 0), 0).toString(), QString("same"));
+}
+
+void tst_qqmllistmodel::setArray()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(
+                "import QtQuick 2.0\n"
+                "ListModel {\n"
+                "   ListElement { value: 0 }\n"
+                "   ListElement { value: 1 }\n"
+                "   ListElement { value: 2 }\n"
+                "}\n", QUrl());
+    QScopedPointer<QQmlListModel> model(qobject_cast<QQmlListModel *>(component.create()));
+    QVERIFY(model);
+
+    QSignalSpy changedSpy(model.data(), &QQmlListModel::dataChanged);
+    QSignalSpy insertedSpy(model.data(), &QQmlListModel::rowsInserted);
+
+    QQmlExpression expr(engine.rootContext(), model.data(),
+                        "set(1, [{value: 10}, {value: 20}, {value: 30}, {value: 40}])");
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), QTest::toString(expr.error().toString()));
+
+    QCOMPARE(model->count(), 5);
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).toModelIndex().row(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).toModelIndex().row(), 2);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 3);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 4);
+
+    const int expected[] = { 0, 10, 20, 30, 40 };
+    for (int i = 0; i < 5; ++i)
+        QCOMPARE(model->data(i, 0).toInt(), expected[i]);
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
@@ -27,6 +27,7 @@
 ****************************************************************************/
 
 #include <qstandardpaths.h>
+#include <qthread.h>
 #include <qtest.h>
 #include <qqml.h>
 #include <qqmlprivate.h>
@@ -34,6 +35,7 @@
 #include <qqmlcomponent.h>
 
 #include <private/qqmlmetatype_p.h>
+#include <private/qqmlpropertycache_p.h>
 #include <private/qqmlpropertyvalueinterceptor_p.h>
 #include <private/qhashedstring_p.h>
 #include "../../shared/util.h"
@@ -64,6 +66,9 @@ private slots:
     void unregisterCustomSingletonType();
 
     void normalizeUrls();
+
+    void propertyCacheFromThreads();
+    void qmlTypeFromThreads();
 };
 
 class TestType : public QObject
@@ -533,6 +538,77 @@ void tst_qqmlmetatype::normalizeUrls()
     QVERIFY(!QQmlMetaType::qmlType(url, /*includeNonFileImports=*/true).isValid());
 }
 
+class PropertyCacheLookupThread : public QThread
+{
+public:
+    QVector<QQmlPropertyCache *> caches;
+
+protected:
+    void run() override
+    {
+        const QMetaObject *metaObjects[] = {
+            &QObject::staticMetaObject, &TestType::staticMetaObject,
+            &TestType2::staticMetaObject, &TestType3::staticMetaObject,
+            &ExternalEnums::staticMetaObject
+        };
+        for (int i = 0; i < 1000; ++i) {
+            for (const QMetaObject *mo : metaObjects)
+                caches.append(QQmlMetaType::propertyCache(mo));
+        }
+    }
+};
+
+void tst_qqmlmetatype::propertyCacheFromThreads()
+{
+    QQmlEngine engine;
+
+    PropertyCacheLookupThread threads[4];
+    for (PropertyCacheLookupThread &thread : threads)
+        thread.start();
+    for (PropertyCacheLookupThread &thread : threads)
+        QVERIFY(thread.wait());
+
+    // All threads must agree on a single cache per meta-object, no matter who created it.
+    const QVector<QQmlPropertyCache *> &expected = threads[0].caches;
+    QVERIFY(!expected.contains(nullptr));
+    for (const PropertyCacheLookupThread &thread : threads)
+        QCOMPARE(thread.caches, expected);
+    QCOMPARE(QQmlMetaType::propertyCache(&TestType::staticMetaObject), expected.at(1));
+}
+
+class QmlTypeLookupThread : public QThread
+{
+public:
+    int found = 0;
+
+protected:
+    void run() override
+    {
+        for (int i = 0; i < 1000; ++i) {
+            if (QQmlMetaType::qmlType(&TestType::staticMetaObject).isValid())
+                ++found;
+            if (QQmlMetaType::qmlType(QString("Test/TestType"), 1, 0).isValid())
+                ++found;
+        }
+    }
+};
+
+void tst_qqmlmetatype::qmlTypeFromThreads()
+{
+    QmlTypeLookupThread threads[4];
+    for (QmlTypeLookupThread &thread : threads)
+        thread.start();
+
+    // Registering and unregistering types modifies the lookup tables while they are read
+    for (int i = 0; i < 100; ++i)
+        qmlUnregisterType(qmlRegisterType<TestType2>("LookupTest", 1, 0, "LookupType"));
+
+    for (QmlTypeLookupThread &thread : threads) {
+        QVERIFY(thread.wait());
+        QCOMPARE(thread.found, 2000);
+    }
+}
+
 QTEST_MAIN(tst_qqmlmetatype)
 
 #include "tst_qqmlmetatype.moc"
@@ -1034,6 +1034,22 @@ Item {
             compare(itemRect(filler), [100,0,100,20])
         }
 
+        function test_rearrangeNestedLayoutsWithSameSizeHints()
+        {
+            var layout = rearrangeNestedLayouts_Component.createObject(container)
+            var fixed = layout.children[0].children[0]
+            var filler = layout.children[0].children[1]
+
+            // Moving the expanding item doesn't change the size hints of the
+            // inner layout, but it still has to be rearranged.
+            fixed.Layout.fillWidth = true
+            filler.Layout.fillWidth = false
+            waitForRendering(layout)
+            compare(itemRect(fixed),  [0,0,200,20])
+            compare(itemRect(filler), [200,0,0,20])
+            layout.destroy()
+        }
+
         Component {
             id: changeChildrenOfHiddenLayout_Component
             RowLayout {
@@ -0,0 +1,27 @@
+import QtQuick 2.11
+
+ListView {
+    id: list
+    width: 100
+    height: 200
+    cacheBuffer: 0
+    cacheItemSizes: true
+
+    model: ListModel {
+        id: listModel
+        Component.onCompleted: {
+            for (var i = 0; i < 200; ++i)
+                append({ size: i < 100 ? 50 : 10 })
+        }
+    }
+
+    function insertRow(index, size) {
+        listModel.insert(index, { size: size })
+    }
+
+    delegate: Rectangle {
+        objectName: "delegate"
+        width: list.width
+        height: size
+    }
+}
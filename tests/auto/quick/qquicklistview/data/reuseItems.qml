@@ -0,0 +1,32 @@
+import QtQuick 2.11
+
+ListView {
+    id: list
+    width: 100
+    height: 200
+    cacheBuffer: 0
+    reuseItems: true
+
+    property int createdCount: 0
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    model: ListModel {
+        Component.onCompleted: {
+            for (var i = 0; i < 100; ++i)
+                append({ name: "Item " + i })
+        }
+    }
+
+    delegate: Text {
+        objectName: "delegate"
+        property int modelIndex: index
+        width: list.width
+        height: 20
+        text: name
+
+        Component.onCompleted: list.createdCount++
+        ListView.onPooled: list.pooledCount++
+        ListView.onReused: list.reusedCount++
+    }
+}
@@ -266,6 +266,8 @@ private slots:
     void QTBUG_61537_modelChangesAsync();
 
     void addOnCompleted();
+    void reuseItems();
+    void cacheItemSizes();
 
 private:
     template <class T> void items(const QUrl &source);
@@ -8791,6 +8793,84 @@ void tst_QQuickListView::addOnCompleted()
     }
 }
 
+void tst_QQuickListView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    QVERIFY(listview->reuseItems());
+    QTRY_COMPARE(listview->property("createdCount").toInt(), 10);
+
+    // Flick a page at a time, the delegates leaving the view are handed to the items entering it.
+    for (int page = 1; page <= 5; ++page) {
+        listview->setContentY(page * 200);
+        QTRY_VERIFY(findItem<QQuickItem>(listview->contentItem(), "delegate", page * 10 + 5));
+    }
+    QCOMPARE(listview->property("createdCount").toInt(), 10);
+    QVERIFY(listview->property("pooledCount").toInt() >= 50);
+    QVERIFY(listview->property("reusedCount").toInt() >= 50);
+
+    // Reused delegates are rebound to their new index and its model data.
+    const QList<QQuickText *> delegates = findItems<QQuickText>(listview->contentItem(), "delegate");
+    QVERIFY(delegates.count() >= 10);
+    for (QQuickText *delegate : delegates) {
+        const int index = delegate->property("modelIndex").toInt();
+        QVERIFY(index >= 49 && index <= 60);
+        QCOMPARE(delegate->text(), QString::fromLatin1("Item %1").arg(index));
+        QCOMPARE(delegate->y(), index * 20.0);
+    }
+
+    // Without reuse, new delegates are created for the items entering the view.
+    listview->setReuseItems(false);
+    listview->setContentY(1200);
+    QTRY_VERIFY(listview->property("createdCount").toInt() > 10);
+}
+
+void tst_QQuickListView::cacheItemSizes()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("cacheItemSizes.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview != nullptr);
+    QVERIFY(listview->cacheItemSizes());
+    QTRY_COMPARE(listview->count(), 200);
+
+    // Scroll through the first 120 items so that their sizes are recorded.
+    for (qreal y = 0; y <= 5200; y += 100) {
+        listview->setContentY(y);
+        QTRY_VERIFY(findItem<QQuickItem>(listview->contentItem(), "delegate", y < 5000 ? int(y / 50) : 100 + int(y - 5000) / 10));
+    }
+
+    listview->positionViewAtIndex(0, QQuickListView::Beginning);
+    QTRY_VERIFY(findItem<QQuickItem>(listview->contentItem(), "delegate", 0));
+    QCOMPARE(listview->originY(), 0.0);
+
+    // Jumping to a measured item places it exactly, without the items in between.
+    listview->positionViewAtIndex(110, QQuickListView::Beginning);
+    QQuickItem *item = findItem<QQuickItem>(listview->contentItem(), "delegate", 110);
+    QVERIFY(item);
+    QCOMPARE(item->y(), 5100.0);
+    QCOMPARE(listview->contentY(), 5100.0);
+    QCOMPARE(listview->originY(), 0.0);
+    QVERIFY(!findItem<QQuickItem>(listview->contentItem(), "delegate", 50));
+
+    // Recorded sizes follow the items when rows are inserted before them.
+    QVERIFY(QMetaObject::invokeMethod(listview, "insertRow", Q_ARG(QVariant, 0), Q_ARG(QVariant, 20)));
+    listview->positionViewAtIndex(0, QQuickListView::Beginning);
+    QTRY_VERIFY(findItem<QQuickItem>(listview->contentItem(), "delegate", 0));
+    listview->positionViewAtIndex(111, QQuickListView::Beginning);
+    item = findItem<QQuickItem>(listview->contentItem(), "delegate", 111);
+    QVERIFY(item);
+    QCOMPARE(item->y() - listview->originY(), 5120.0);
+}
+
 QTEST_MAIN(tst_QQuickListView)
 
 #include "tst_qquicklistview.moc"
@@ -0,0 +1,36 @@
+import QtQuick 2.11
+
+PathView {
+    id: view
+    width: 500
+    height: 100
+    pathItemCount: 5
+    reuseItems: true
+
+    property int createdCount: 0
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    model: ListModel {
+        Component.onCompleted: {
+            for (var i = 0; i < 20; ++i)
+                append({ name: "Item " + i })
+        }
+    }
+
+    path: Path {
+        startX: 0; startY: 50
+        PathLine { x: 500; y: 50 }
+    }
+
+    delegate: Text {
+        objectName: "wrapper"
+        property int modelIndex: index
+        property bool onPath: PathView.onPath
+        text: name
+
+        Component.onCompleted: view.createdCount++
+        PathView.onPooled: view.pooledCount++
+        PathView.onReused: view.reusedCount++
+    }
+}
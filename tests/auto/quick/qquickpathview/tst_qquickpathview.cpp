@@ -147,6 +147,7 @@ private slots:
     void movementDirection();
     void removePath();
     void objectModelMove();
+    void reuseItems();
 };
 
 class TestObject : public QObject
@@ -2625,6 +2626,44 @@ void tst_QQuickPathView::objectModelMove()
     }
 }
 
+void tst_QQuickPathView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickPathView *pathview = qobject_cast<QQuickPathView *>(window->rootObject());
+    QVERIFY(pathview != nullptr);
+    QVERIFY(pathview->reuseItems());
+    const int created = pathview->property("createdCount").toInt();
+    QVERIFY(created >= 5);
+
+    // Step along the path, the delegate leaving it is handed to the one entering it.
+    for (int offset = 1; offset <= 10; ++offset)
+        pathview->setOffset(offset);
+    QCOMPARE(pathview->property("createdCount").toInt(), created);
+    QVERIFY(pathview->property("pooledCount").toInt() >= 10);
+    QVERIFY(pathview->property("reusedCount").toInt() >= 10);
+
+    // Reused delegates are rebound to their new index and its model data.
+    int onPath = 0;
+    const QList<QQuickText *> delegates = findItems<QQuickText>(pathview, "wrapper");
+    for (QQuickText *delegate : delegates) {
+        if (!delegate->property("onPath").toBool())
+            continue;
+        ++onPath;
+        const int index = delegate->property("modelIndex").toInt();
+        QCOMPARE(delegate->text(), QString::fromLatin1("Item %1").arg(index));
+    }
+    QCOMPARE(onPath, 5);
+
+    // Without reuse, new delegates are created for the items entering the path.
+    pathview->setReuseItems(false);
+    pathview->setOffset(15);
+    QVERIFY(pathview->property("createdCount").toInt() > created);
+}
+
 QTEST_MAIN(tst_QQuickPathView)
 
 #include "tst_qquickpathview.moc"
@@ -0,0 +1,23 @@
+import QtQuick 2.0
+
+Item {
+    width: 640
+    height: 480
+
+    Column {
+        objectName: "column"
+        Rectangle { id: a; objectName: "a"; width: 50; height: 10 }
+        Rectangle { id: b; objectName: "b"; width: 50; height: 10 }
+        Rectangle { id: c; objectName: "c"; width: 50; height: 10 }
+        Rectangle { id: d; objectName: "d"; width: 50; height: b.y + 10 }
+    }
+
+    Row {
+        objectName: "row"
+        y: 200
+        Rectangle { id: ra; objectName: "ra"; width: 10; height: 50 }
+        Rectangle { id: rb; objectName: "rb"; width: 10; height: 50 }
+        Rectangle { id: rc; objectName: "rc"; width: 10; height: 50 }
+        Rectangle { id: rd; objectName: "rd"; width: rb.x + 10; height: 50 }
+    }
+}
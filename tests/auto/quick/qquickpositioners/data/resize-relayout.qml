@@ -0,0 +1,32 @@
+import QtQuick 2.0
+
+Item {
+    width: 640
+    height: 480
+
+    Column {
+        objectName: "column"
+        Repeater {
+            model: 100
+            Rectangle {
+                objectName: "rect" + index
+                width: 50
+                height: 10
+            }
+        }
+    }
+
+    Flow {
+        objectName: "flow"
+        x: 100
+        width: 100
+        Repeater {
+            model: 10
+            Rectangle {
+                objectName: "flowRect" + index
+                width: 50
+                height: 10
+            }
+        }
+    }
+}
@@ -98,6 +98,8 @@ private slots:
     void test_attachedproperties();
     void test_attachedproperties_data();
     void test_attachedproperties_dynamic();
+    void test_resize_relayout();
+    void test_resize_dependent();
 
     void populateTransitions_row();
     void populateTransitions_row_data();
@@ -4004,6 +4006,104 @@ void tst_qquickpositioners::test_attachedproperties_dynamic()
 
 }
 
+void tst_qquickpositioners::test_resize_relayout()
+{
+    QScopedPointer<QQuickView> window(createView(testFile("resize-relayout.qml")));
+    QVERIFY(window->rootObject() != nullptr);
+
+    QQuickColumn *column = window->rootObject()->findChild<QQuickColumn *>("column");
+    QVERIFY(column != nullptr);
+    QCOMPARE(column->height(), 1000.0);
+
+    QQuickRectangle *rect5 = findItem<QQuickRectangle>(column, "rect5");
+    QQuickRectangle *rect10 = findItem<QQuickRectangle>(column, "rect10");
+    QQuickRectangle *rect11 = findItem<QQuickRectangle>(column, "rect11");
+    QVERIFY(rect5 != nullptr);
+    QVERIFY(rect10 != nullptr);
+    QVERIFY(rect11 != nullptr);
+
+    // Several resizes are handled by a single layout.
+    QSignalSpy spy(column, SIGNAL(positioningComplete()));
+    rect10->setHeight(20);
+    rect5->setHeight(15);
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(findItem<QQuickRectangle>(column, "rect4")->y(), 40.0);
+    QCOMPARE(rect5->y(), 50.0);
+    QCOMPARE(findItem<QQuickRectangle>(column, "rect6")->y(), 65.0);
+    QCOMPARE(rect10->y(), 105.0);
+    QCOMPARE(rect11->y(), 125.0);
+    QCOMPARE(column->height(), 1015.0);
+    QCoreApplication::processEvents();
+    QCOMPARE(spy.count(), 1);
+
+    // Hiding an item still removes it from the layout.
+    rect10->setVisible(false);
+    QTRY_COMPARE(rect11->y(), 105.0);
+    QCOMPARE(column->height(), 995.0);
+
+    QQuickFlow *flow = window->rootObject()->findChild<QQuickFlow *>("flow");
+    QVERIFY(flow != nullptr);
+    QCOMPARE(flow->height(), 50.0);
+
+    QQuickRectangle *flowRect3 = findItem<QQuickRectangle>(flow, "flowRect3");
+    QVERIFY(flowRect3 != nullptr);
+    QCOMPARE(flowRect3->position(), QPointF(50, 10));
+
+    flowRect3->setWidth(60);
+    QTRY_COMPARE(flowRect3->position(), QPointF(0, 20));
+    QCOMPARE(findItem<QQuickRectangle>(flow, "flowRect2")->position(), QPointF(0, 10));
+    QCOMPARE(findItem<QQuickRectangle>(flow, "flowRect4")->position(), QPointF(0, 30));
+    QCOMPARE(findItem<QQuickRectangle>(flow, "flowRect5")->position(), QPointF(50, 30));
+    QCOMPARE(flow->height(), 60.0);
+}
+
+void tst_qquickpositioners::test_resize_dependent()
+{
+    QScopedPointer<QQuickView> window(createView(testFile("resize-dependent.qml")));
+    QVERIFY(window->rootObject() != nullptr);
+
+    // The last child's size follows the position of an earlier sibling, so
+    // it changes while the positioner is laying out its children.
+    QQuickColumn *column = window->rootObject()->findChild<QQuickColumn *>("column");
+    QVERIFY(column != nullptr);
+    QQuickRectangle *a = findItem<QQuickRectangle>(column, "a");
+    QQuickRectangle *c = findItem<QQuickRectangle>(column, "c");
+    QQuickRectangle *d = findItem<QQuickRectangle>(column, "d");
+    QVERIFY(a != nullptr);
+    QVERIFY(c != nullptr);
+    QVERIFY(d != nullptr);
+    QCOMPARE(c->y(), 20.0);
+    QCOMPARE(d->y(), 30.0);
+    QCOMPARE(d->height(), 20.0);
+    QCOMPARE(column->height(), 50.0);
+
+    a->setHeight(20);
+    QTRY_COMPARE(column->height(), 70.0);
+    QCOMPARE(findItem<QQuickRectangle>(column, "b")->y(), 20.0);
+    QCOMPARE(c->y(), 30.0);
+    QCOMPARE(d->y(), 40.0);
+    QCOMPARE(d->height(), 30.0);
+
+    QQuickRow *row = window->rootObject()->findChild<QQuickRow *>("row");
+    QVERIFY(row != nullptr);
+    QQuickRectangle *ra = findItem<QQuickRectangle>(row, "ra");
+    QQuickRectangle *rc = findItem<QQuickRectangle>(row, "rc");
+    QQuickRectangle *rd = findItem<QQuickRectangle>(row, "rd");
+    QVERIFY(ra != nullptr);
+    QVERIFY(rc != nullptr);
+    QVERIFY(rd != nullptr);
+    QCOMPARE(rc->x(), 20.0);
+    QCOMPARE(rd->x(), 30.0);
+    QCOMPARE(row->width(), 50.0);
+
+    ra->setWidth(20);
+    QTRY_COMPARE(row->width(), 70.0);
+    QCOMPARE(findItem<QQuickRectangle>(row, "rb")->x(), 20.0);
+    QCOMPARE(rc->x(), 30.0);
+    QCOMPARE(rd->x(), 40.0);
+    QCOMPARE(rd->width(), 30.0);
+}
+
 QQuickView *tst_qquickpositioners::createView(const QString &filename, bool wait)
 {
     QQuickView *window = new QQuickView(nullptr);
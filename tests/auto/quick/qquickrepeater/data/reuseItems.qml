@@ -0,0 +1,36 @@
+import QtQuick 2.11
+
+Column {
+    id: root
+
+    property int createdCount: 0
+    property int destroyedCount: 0
+
+    function refill(prefix) {
+        fruits.clear()
+        for (var i = 0; i < 5; ++i)
+            fruits.append({ name: prefix + i })
+    }
+
+    function removeFirst(count) {
+        fruits.remove(0, count)
+    }
+
+    Repeater {
+        objectName: "repeater"
+        reuseItems: true
+        model: ListModel {
+            id: fruits
+            Component.onCompleted: root.refill("a")
+        }
+
+        Text {
+            property int modelIndex: index
+            height: 10
+            text: name
+
+            Component.onCompleted: root.createdCount++
+            Component.onDestruction: root.destroyedCount++
+        }
+    }
+}
@@ -76,6 +76,7 @@ private slots:
     void stackingOrder();
     void objectModel();
     void QTBUG54859_asynchronousMove();
+    void reuseItems();
 };
 
 class TestObject : public QObject
@@ -1014,6 +1015,44 @@ void tst_QQuickRepeater::QTBUG54859_asynchronousMove()
     QTRY_COMPARE(item->property("finished"), QVariant(true));
 }
 
+void tst_QQuickRepeater::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickItem *root = window->rootObject();
+    QQuickRepeater *repeater = findItem<QQuickRepeater>(root, "repeater");
+    QVERIFY(repeater != nullptr);
+    QVERIFY(repeater->reuseItems());
+    QCOMPARE(repeater->count(), 5);
+    QCOMPARE(root->property("createdCount").toInt(), 5);
+
+    // Refilling the model in one go hands the removed delegates to the inserted rows.
+    QSignalSpy addedSpy(repeater, SIGNAL(itemAdded(int,QQuickItem*)));
+    QMetaObject::invokeMethod(root, "refill", Q_ARG(QVariant, QStringLiteral("b")));
+    QCOMPARE(repeater->count(), 5);
+    QCOMPARE(addedSpy.count(), 5);
+    QCOMPARE(root->property("createdCount").toInt(), 5);
+    for (int i = 0; i < 5; ++i) {
+        QQuickText *text = qobject_cast<QQuickText *>(repeater->itemAt(i));
+        QVERIFY(text != nullptr);
+        QCOMPARE(text->parentItem(), root);
+        QCOMPARE(text->property("modelIndex").toInt(), i);
+        QCOMPARE(text->text(), QString::fromLatin1("b%1").arg(i));
+        QTRY_COMPARE(text->y(), i * 10.0);
+    }
+    QCOMPARE(root->property("destroyedCount").toInt(), 0);
+
+    // Delegates that no insertion picks up are destroyed with the next frame.
+    QMetaObject::invokeMethod(root, "removeFirst", Q_ARG(QVariant, 2));
+    QCOMPARE(repeater->count(), 3);
+    QTRY_COMPARE(root->property("destroyedCount").toInt(), 2);
+    QCOMPARE(root->property("createdCount").toInt(), 5);
+    QCOMPARE(qobject_cast<QQuickText *>(repeater->itemAt(0))->text(), QStringLiteral("b2"));
+}
+
 QTEST_MAIN(tst_QQuickRepeater)
 
 #include "tst_qquickrepeater.moc"
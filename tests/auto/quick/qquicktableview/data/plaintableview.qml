@@ -0,0 +1,24 @@
+import QtQuick 2.11
+
+TableView {
+    id: tableView
+    width: 600
+    height: 400
+    cacheBuffer: 0
+
+    property int createdCount: 0
+    property int reusedCount: 0
+    property int pooledCount: 0
+
+    delegate: Rectangle {
+        objectName: "tableViewDelegate"
+        implicitWidth: 100
+        implicitHeight: 50
+        property var modelDataBinding: model.display
+        property int cellRow: TableView.row
+        property int cellColumn: TableView.column
+        Component.onCompleted: tableView.createdCount++
+        TableView.onReused: tableView.reusedCount++
+        TableView.onPooled: tableView.pooledCount++
+    }
+}
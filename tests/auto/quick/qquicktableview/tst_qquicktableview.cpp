@@ -0,0 +1,347 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquicktableview_p.h>
+
+#include "../../shared/util.h"
+#include "../shared/viewtestutil.h"
+#include "../shared/visualtestutil.h"
+
+using namespace QQuickViewTestUtil;
+using namespace QQuickVisualTestUtil;
+
+static const char *delegateName = "tableViewDelegate";
+
+class TestTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    TestTableModel(int rows, int columns, QObject *parent = nullptr)
+        : QAbstractTableModel(parent), m_rows(rows), m_columns(columns) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_rows;
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_columns;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || role != Qt::DisplayRole)
+            return QVariant();
+        const QString text = m_data.value(index.row() * m_columns + index.column());
+        return text.isEmpty() ? QString::number(index.row()) + QLatin1Char(',') + QString::number(index.column()) : text;
+    }
+
+    void setCellText(int row, int column, const QString &text)
+    {
+        m_data.insert(row * m_columns + column, text);
+        const QModelIndex cell = index(row, column);
+        emit dataChanged(cell, cell, QVector<int>() << Qt::DisplayRole);
+    }
+
+    void appendRows(int count)
+    {
+        beginInsertRows(QModelIndex(), m_rows, m_rows + count - 1);
+        m_rows += count;
+        endInsertRows();
+    }
+
+private:
+    int m_rows;
+    int m_columns;
+    QHash<int, QString> m_data;
+};
+
+class tst_QQuickTableView : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void setModel();
+    void countDelegateItems_data();
+    void countDelegateItems();
+    void checkLayout();
+    void checkSpacing();
+    void flick();
+    void reuseItems();
+    void noReuseItems();
+    void dataChanged();
+    void insertRows();
+    void listModel();
+
+private:
+    QQuickTableView *createTableView(QQuickView *window, TestTableModel *model);
+    QQuickItem *cellItem(QQuickTableView *tableView, int row, int column);
+};
+
+QQuickTableView *tst_QQuickTableView::createTableView(QQuickView *window, TestTableModel *model)
+{
+    window->setSource(testFileUrl("plaintableview.qml"));
+    window->show();
+    if (!QTest::qWaitForWindowExposed(window))
+        return nullptr;
+
+    QQuickTableView *tableView = qobject_cast<QQuickTableView *>(window->rootObject());
+    if (tableView && model)
+        tableView->setModel(QVariant::fromValue(model));
+    return tableView;
+}
+
+QQuickItem *tst_QQuickTableView::cellItem(QQuickTableView *tableView, int row, int column)
+{
+    const QList<QQuickItem *> items = findItems<QQuickItem>(tableView->contentItem(), delegateName);
+    for (QQuickItem *item : items) {
+        if (item->property("cellRow").toInt() == row && item->property("cellColumn").toInt() == column)
+            return item;
+    }
+    return nullptr;
+}
+
+void tst_QQuickTableView::setModel()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 30);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+
+    QCOMPARE(tableView->rows(), 100);
+    QCOMPARE(tableView->columns(), 30);
+
+    TestTableModel otherModel(5, 4);
+    QSignalSpy rowsSpy(tableView, SIGNAL(rowsChanged()));
+    QSignalSpy columnsSpy(tableView, SIGNAL(columnsChanged()));
+    tableView->setModel(QVariant::fromValue(&otherModel));
+    QCOMPARE(tableView->rows(), 5);
+    QCOMPARE(tableView->columns(), 4);
+    QCOMPARE(rowsSpy.count(), 1);
+    QCOMPARE(columnsSpy.count(), 1);
+
+    QTRY_COMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 20);
+}
+
+void tst_QQuickTableView::countDelegateItems_data()
+{
+    QTest::addColumn<int>("rows");
+    QTest::addColumn<int>("columns");
+    QTest::addColumn<int>("expectedItems");
+
+    // The view is 600x400 and the cells 100x50, which fits 6 columns and 8 rows
+    QTest::newRow("1x1") << 1 << 1 << 1;
+    QTest::newRow("2x3") << 2 << 3 << 6;
+    QTest::newRow("8x6") << 8 << 6 << 48;
+    QTest::newRow("100x100") << 100 << 100 << 48;
+    QTest::newRow("10000x1") << 10000 << 1 << 8;
+}
+
+void tst_QQuickTableView::countDelegateItems()
+{
+    QFETCH(int, rows);
+    QFETCH(int, columns);
+    QFETCH(int, expectedItems);
+
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(rows, columns);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+
+    QTRY_COMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), expectedItems);
+}
+
+void tst_QQuickTableView::checkLayout()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+
+    QQuickItem *item = nullptr;
+    QTRY_VERIFY((item = cellItem(tableView, 3, 2)));
+    QCOMPARE(item->position(), QPointF(200, 150));
+    QCOMPARE(item->size(), QSizeF(100, 50));
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("3,2"));
+
+    // The content size is estimated from the size of the loaded rows and columns
+    QCOMPARE(tableView->contentWidth(), 100. * 100);
+    QCOMPARE(tableView->contentHeight(), 100. * 50);
+}
+
+void tst_QQuickTableView::checkSpacing()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+
+    tableView->setRowSpacing(10);
+    tableView->setColumnSpacing(20);
+
+    QQuickItem *item = nullptr;
+    QTRY_VERIFY((item = cellItem(tableView, 2, 1)));
+    QTRY_COMPARE(item->position(), QPointF(120, 120));
+    QCOMPARE(tableView->contentWidth(), 100. * 120 - 20);
+    QCOMPARE(tableView->contentHeight(), 100. * 60 - 10);
+
+    // 600 / 120 and 400 / 60, rounded up
+    QCOMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 5 * 7);
+}
+
+void tst_QQuickTableView::flick()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+    QTRY_VERIFY(cellItem(tableView, 0, 0));
+
+    // Move a bit at a time, loading and unloading single rows and columns
+    for (int step = 1; step <= 20; ++step) {
+        tableView->setContentX(step * 25);
+        tableView->setContentY(step * 25);
+        QTRY_VERIFY(cellItem(tableView, step / 2, step / 4));
+    }
+    QVERIFY(!cellItem(tableView, 0, 0));
+
+    // Jump far away, which rebuilds the table around the new viewport
+    tableView->setContentX(5000);
+    tableView->setContentY(2500);
+    QQuickItem *item = nullptr;
+    QTRY_VERIFY((item = cellItem(tableView, 50, 50)));
+    QCOMPARE(item->position(), QPointF(5000, 2500));
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("50,50"));
+    QCOMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 48);
+
+    // Back to the start
+    tableView->setContentX(0);
+    tableView->setContentY(0);
+    QTRY_VERIFY((item = cellItem(tableView, 0, 0)));
+    QCOMPARE(item->position(), QPointF(0, 0));
+    QCOMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 48);
+}
+
+void tst_QQuickTableView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+    QVERIFY(tableView->reuseItems());
+    QTRY_COMPARE(tableView->property("createdCount").toInt(), 48);
+
+    // Flick a page at a time, the items leaving the view are handed to the cells entering it
+    for (int page = 1; page <= 5; ++page) {
+        tableView->setContentX(page * 600);
+        tableView->setContentY(page * 400);
+        QTRY_VERIFY(cellItem(tableView, page * 8, page * 6));
+    }
+    QCOMPARE(tableView->property("createdCount").toInt(), 48);
+    QVERIFY(tableView->property("reusedCount").toInt() >= 5 * 48);
+    QCOMPARE(tableView->property("pooledCount").toInt(), tableView->property("reusedCount").toInt());
+
+    QQuickItem *item = cellItem(tableView, 45, 33);
+    QVERIFY(item);
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("45,33"));
+}
+
+void tst_QQuickTableView::noReuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+    tableView->setReuseItems(false);
+    QTRY_COMPARE(tableView->property("createdCount").toInt(), 48);
+
+    tableView->setContentX(600);
+    QTRY_VERIFY(cellItem(tableView, 0, 6));
+    QCOMPARE(tableView->property("createdCount").toInt(), 2 * 48);
+    QCOMPARE(tableView->property("reusedCount").toInt(), 0);
+}
+
+void tst_QQuickTableView::dataChanged()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(100, 100);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+
+    QQuickItem *item = nullptr;
+    QTRY_VERIFY((item = cellItem(tableView, 2, 3)));
+    model.setCellText(2, 3, QStringLiteral("changed"));
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("changed"));
+    QCOMPARE(cellItem(tableView, 3, 2)->property("modelDataBinding").toString(), QStringLiteral("3,2"));
+}
+
+void tst_QQuickTableView::insertRows()
+{
+    QScopedPointer<QQuickView> window(createView());
+    TestTableModel model(2, 3);
+    QQuickTableView *tableView = createTableView(window.data(), &model);
+    QVERIFY(tableView);
+    QTRY_COMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 6);
+
+    QSignalSpy rowsSpy(tableView, SIGNAL(rowsChanged()));
+    model.appendRows(2);
+    QCOMPARE(rowsSpy.count(), 1);
+    QCOMPARE(tableView->rows(), 4);
+    QTRY_COMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 12);
+
+    QQuickItem *item = cellItem(tableView, 3, 2);
+    QVERIFY(item);
+    QCOMPARE(item->position(), QPointF(200, 150));
+    QCOMPARE(item->property("modelDataBinding").toString(), QStringLiteral("3,2"));
+}
+
+void tst_QQuickTableView::listModel()
+{
+    // Models without columns are shown as a single column
+    QScopedPointer<QQuickView> window(createView());
+    QQuickTableView *tableView = createTableView(window.data(), nullptr);
+    QVERIFY(tableView);
+
+    QStringList list;
+    for (int i = 0; i < 20; ++i)
+        list << QString::number(i) + QLatin1String(",0");
+    tableView->setModel(list);
+
+    QCOMPARE(tableView->rows(), 20);
+    QCOMPARE(tableView->columns(), 1);
+    QTRY_COMPARE(findItems<QQuickItem>(tableView->contentItem(), delegateName).count(), 8);
+}
+
+QTEST_MAIN(tst_QQuickTableView)
+
+#include "tst_qquicktableview.moc"
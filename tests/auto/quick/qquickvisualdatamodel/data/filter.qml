@@ -0,0 +1,14 @@
+import QtQuick 2.0
+import QtQml.Models 2.11
+
+DelegateModel {
+    groups: DelegateModelGroup {
+        objectName: "filtered"
+        name: "filtered"
+        filterRole: "name"
+        filterValue: "Fruit"
+    }
+    filterOnGroup: "filtered"
+    model: myModel
+    delegate: Item {}
+}
@@ -0,0 +1,8 @@
+import QtQuick 2.0
+import QtQml.Models 2.11
+
+DelegateModel {
+    sortRole: "name"
+    model: myModel
+    delegate: Item {}
+}
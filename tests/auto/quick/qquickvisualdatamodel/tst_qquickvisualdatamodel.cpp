@@ -40,10 +40,12 @@
 #include <private/qquicklistview_p.h>
 #include <QtQuick/private/qquicktext_p.h>
 #include <QtQml/private/qqmldelegatemodel_p.h>
+#include <QtQml/private/qqmldelegatemodel_p_p.h>
 #include <private/qqmlvaluetype_p.h>
 #include <private/qqmlchangeset_p.h>
 #include <private/qqmlengine_p.h>
 #include <math.h>
+#include <QtCore/qthread.h>
 #include <QtGui/qstandarditemmodel.h>
 
 using namespace QQuickVisualTestUtil;
@@ -239,6 +241,51 @@ private:
     Branch trunk;
 };
 
+// Declares thread safe data, and records reads from other threads that happen
+// while the model is being reset.
+class ThreadedDataModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_CLASSINFO("ThreadSafeData", "true")
+public:
+    ThreadedDataModel(int rows) : rows(rows), resetting(0), readsDuringReset(0) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : rows;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (QThread::currentThread() != thread()) {
+            QThread::msleep(1);
+            if (resetting.load())
+                readsDuringReset.ref();
+        }
+        return role == Qt::DisplayRole ? QVariant(QString::number(index.row())) : QVariant();
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        QHash<int, QByteArray> roles;
+        roles.insert(Qt::DisplayRole, "name");
+        return roles;
+    }
+
+    void reset()
+    {
+        beginResetModel();
+        resetting.store(1);
+        QThread::msleep(10);
+        resetting.store(0);
+        endResetModel();
+    }
+
+    int rows;
+    QAtomicInt resetting;
+    mutable QAtomicInt readsDuringReset;
+};
+
 class StandardItem : public QObject, public QStandardItem
 {
     Q_OBJECT
@@ -431,6 +478,11 @@ private slots:
     void asynchronousMove_data();
     void asynchronousCancel();
     void invalidContext();
+    void prefetch();
+    void prefetchModelReset();
+    void filter();
+    void sort();
+    void sortLargeModel();
 
 private:
     template <int N> void groups_verify(
@@ -4234,6 +4286,218 @@ void tst_qquickvisualdatamodel::invalidContext()
     QVERIFY(!item);
 }
 
+void tst_qquickvisualdatamodel::prefetch()
+{
+    QQmlEngine engine;
+    QStringList list;
+    for (int i = 0; i < 16; ++i)
+        list << QString::number(i);
+    SingleRoleModel model(list);
+
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent c(&engine, testFileUrl("prefetch.qml"));
+    QScopedPointer<QQmlDelegateModel> visualModel(qobject_cast<QQmlDelegateModel *>(c.create()));
+    QVERIFY(visualModel);
+    QCOMPARE(visualModel->prefetchCount(), 4);
+
+    // Delegates must see the same data whether it was prefetched or not.
+    QList<QObject *> items;
+    for (int i = 0; i < 10; ++i) {
+        QObject *item = visualModel->object(i, QQmlIncubator::Synchronous);
+        QVERIFY(item);
+        QCOMPARE(item->property("value").toString(), list.at(i));
+        items.append(item);
+        QCoreApplication::processEvents();
+    }
+
+    // Changes made after a row was prefetched are not masked by the cached data.
+    model.set(9, "Changed");
+    QCOMPARE(items.at(9)->property("value").toString(), QString("Changed"));
+
+    for (QObject *item : qAsConst(items))
+        visualModel->release(item);
+
+    QSignalSpy spy(visualModel.data(), SIGNAL(prefetchCountChanged()));
+    visualModel->setPrefetchCount(0);
+    QCOMPARE(spy.count(), 1);
+    visualModel->setPrefetchCount(-1);
+    QCOMPARE(visualModel->prefetchCount(), 0);
+    QCOMPARE(spy.count(), 1);
+}
+
+void tst_qquickvisualdatamodel::prefetchModelReset()
+{
+    QQmlEngine engine;
+    ThreadedDataModel model(500);
+
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent c(&engine, testFileUrl("prefetch.qml"));
+    QScopedPointer<QQmlDelegateModel> visualModel(qobject_cast<QQmlDelegateModel *>(c.create()));
+    QVERIFY(visualModel);
+    visualModel->setPrefetchCount(50);
+
+    // Reset the model while the worker thread is in the middle of a batch.
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 5; ++i) {
+            QObject *item = visualModel->object(round * 50 + i, QQmlIncubator::Synchronous);
+            QVERIFY(item);
+            QCOMPARE(item->property("value").toString(), QString::number(round * 50 + i));
+            visualModel->release(item);
+        }
+        model.reset();
+        QCoreApplication::processEvents();
+    }
+    QCOMPARE(model.readsDuringReset.load(), 0);
+
+    // Taking the model away stops the worker as well.
+    QObject *item = visualModel->object(300, QQmlIncubator::Synchronous);
+    QVERIFY(item);
+    visualModel->release(item);
+    visualModel->setModel(QVariant());
+    model.reset();
+    QCOMPARE(model.readsDuringReset.load(), 0);
+}
+
+void tst_qquickvisualdatamodel::filter()
+{
+    QQmlEngine engine;
+    QaimModel model;
+    model.addItem("Fruit", "1");
+    model.addItem("Vegetable", "2");
+    model.addItem("Fruit", "3");
+    model.addItem("Nut", "4");
+
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent c(&engine, testFileUrl("filter.qml"));
+    QScopedPointer<QQmlDelegateModel> visualModel(qobject_cast<QQmlDelegateModel *>(c.create()));
+    QVERIFY(visualModel);
+
+    QQmlDelegateModelGroup *filtered = visualModel->findChild<QQmlDelegateModelGroup *>("filtered");
+    QVERIFY(filtered);
+    QCOMPARE(filtered->count(), 2);
+    QCOMPARE(visualModel->count(), 2);
+    QCOMPARE(visualModel->items()->count(), 4);
+
+    // Filtering doesn't need delegates.
+    QCOMPARE(QQmlDelegateModelPrivate::get(visualModel.data())->m_cache.count(), 0);
+
+    model.insertItem(1, "Fruit", "5");
+    QCOMPARE(filtered->count(), 3);
+
+    // Items that don't match are never reported to views of the group.
+    QSignalSpy spy(visualModel.data(), SIGNAL(modelUpdated(QQmlChangeSet,bool)));
+    model.insertItem(1, "Nut", "6");
+    QCOMPARE(filtered->count(), 3);
+    QCOMPARE(visualModel->items()->count(), 6);
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(qvariant_cast<QQmlChangeSet>(spy.at(0).at(0)).inserts().isEmpty());
+
+    model.modifyItem(5, "Fruit", "4");
+    QCOMPARE(filtered->count(), 4);
+    model.modifyItem(0, "Vegetable", "1");
+    QCOMPARE(filtered->count(), 3);
+
+    filtered->setFilterValue(QVariantList() << "Nut" << "Vegetable");
+    QCOMPARE(filtered->count(), 3);
+
+    filtered->setFilterValue(QRegExp("^N"));
+    QCOMPARE(filtered->count(), 1);
+
+    model.removeItem(1);
+    QCOMPARE(filtered->count(), 0);
+
+    // Clearing the role keeps the current members.
+    filtered->setFilterValue("Fruit");
+    QCOMPARE(filtered->count(), 3);
+    filtered->setFilterRole(QString());
+    model.insertItem(0, "Fruit", "7");
+    QCOMPARE(filtered->count(), 3);
+}
+
 QTEST_MAIN(tst_qquickvisualdatamodel)
 
+static QString sortedNumbers(QQmlDelegateModel *visualModel)
+{
+    QStringList numbers;
+    for (int i = 0; i < visualModel->count(); ++i)
+        numbers << visualModel->stringValue(i, QStringLiteral("number"));
+    return numbers.join(QLatin1Char(' '));
+}
+
+void tst_qquickvisualdatamodel::sort()
+{
+    QQmlEngine engine;
+    QaimModel model;
+    model.addItem("Cherry", "1");
+    model.addItem("Apple", "2");
+    model.addItem("Banana", "3");
+    model.addItem("Apple", "4");
+
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent c(&engine, testFileUrl("sort.qml"));
+    QScopedPointer<QQmlDelegateModel> visualModel(qobject_cast<QQmlDelegateModel *>(c.create()));
+    QVERIFY(visualModel);
+
+    // Equal values keep their model order.
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("2 4 3 1"));
+
+    // Sorting doesn't need delegates.
+    QCOMPARE(QQmlDelegateModelPrivate::get(visualModel.data())->m_cache.count(), 0);
+
+    model.insertItem(0, "Banana", "5");
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("2 4 5 3 1"));
+
+    // A changed item is moved into place in the same update.
+    QSignalSpy spy(visualModel.data(), SIGNAL(modelUpdated(QQmlChangeSet,bool)));
+    model.modifyItem(1, "Apple", "1");
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("1 2 4 5 3"));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(qvariant_cast<QQmlChangeSet>(spy.at(0).at(0)).inserts().count(), 1);
+
+    visualModel->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("5 3 1 2 4"));
+
+    model.moveItems(0, 4, 1);
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("3 5 1 2 4"));
+
+    model.removeItem(2);
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("5 1 2 4"));
+
+    model.resetItems(QList<QPair<QString, QString> >()
+            << qMakePair(QString("Apple"), QString("6"))
+            << qMakePair(QString("Cherry"), QString("7")));
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("7 6"));
+
+    // Clearing the role keeps the current order.
+    visualModel->setSortRole(QString());
+    QCOMPARE(sortedNumbers(visualModel.data()), QString("7 6"));
+}
+
+void tst_qquickvisualdatamodel::sortLargeModel()
+{
+    // Large enough to be sorted on several threads.
+    const int count = 50000;
+
+    QQmlEngine engine;
+    QaimModel model;
+    QList<QPair<QString, QString> > items;
+    for (int i = 0; i < count; ++i)
+        items << qMakePair(QString::number((i * 7919) % count).rightJustified(5, QLatin1Char('0')), QString::number(i));
+    model.addItems(items);
+
+    engine.rootContext()->setContextProperty("myModel", &model);
+
+    QQmlComponent c(&engine, testFileUrl("sort.qml"));
+    QScopedPointer<QQmlDelegateModel> visualModel(qobject_cast<QQmlDelegateModel *>(c.create()));
+    QVERIFY(visualModel);
+    QCOMPARE(visualModel->count(), count);
+
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(visualModel->stringValue(i, "name").toInt(), i);
+}
+
 #include "tst_qquickvisualdatamodel.moc"
@@ -0,0 +1,22 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    color: "white"
+    // The geometry is outside the window, the vertex shader moves it in
+    ShaderEffect {
+        x: 1000; width: 100; height: 100
+        vertexShader: "
+            uniform highp mat4 qt_Matrix;
+            attribute highp vec4 qt_Vertex;
+            void main() {
+                gl_Position = qt_Matrix * (qt_Vertex - vec4(1000.0, 0.0, 0.0, 0.0));
+            }"
+        fragmentShader: "
+            uniform lowp float qt_Opacity;
+            void main() {
+                gl_FragColor = vec4(0.0, 0.0, 1.0, 1.0) * qt_Opacity;
+            }"
+    }
+}
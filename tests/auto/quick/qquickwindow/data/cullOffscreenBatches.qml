@@ -0,0 +1,13 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    color: "white"
+    Rectangle { width: 100; height: 100; color: "red" }
+    // The clip keeps the blue rectangle out of the red one's batch
+    Item {
+        objectName: "offscreen"; x: 1000; width: 100; height: 100; clip: true
+        Rectangle { anchors.fill: parent; color: "blue" }
+    }
+}
@@ -0,0 +1,21 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 300; height: 180
+    color: "white"
+    // One merged batch with enough vertices to be copied in parallel,
+    // rotated so that the vertices go through the full transform
+    Item {
+        anchors.fill: parent
+        rotation: 5
+        Repeater {
+            model: 6000
+            Rectangle {
+                x: (index % 100) * 3; y: Math.floor(index / 100) * 3
+                width: 2; height: 2
+                color: Qt.rgba((index % 100) / 100, Math.floor(index / 100) / 60, 0.5, 1)
+            }
+        }
+    }
+}
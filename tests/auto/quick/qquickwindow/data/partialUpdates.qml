@@ -0,0 +1,9 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    color: "white"
+    Rectangle { objectName: "left"; width: 100; height: 100; color: "red" }
+    Rectangle { objectName: "right"; x: 100; width: 100; height: 100; color: "blue" }
+}
@@ -0,0 +1,25 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    color: "white"
+    // The geometry is at the top left, the vertex shader moves it by offset
+    ShaderEffect {
+        objectName: "effect"
+        width: 100; height: 100
+        property real offset: 100
+        vertexShader: "
+            uniform highp mat4 qt_Matrix;
+            uniform highp float offset;
+            attribute highp vec4 qt_Vertex;
+            void main() {
+                gl_Position = qt_Matrix * (qt_Vertex + vec4(offset, 0.0, 0.0, 0.0));
+            }"
+        fragmentShader: "
+            uniform lowp float qt_Opacity;
+            void main() {
+                gl_FragColor = vec4(0.0, 0.0, 1.0, 1.0) * qt_Opacity;
+            }"
+    }
+}
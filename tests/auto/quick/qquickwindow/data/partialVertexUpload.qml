@@ -0,0 +1,17 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    color: "white"
+    // Opaque rectangles end up in one merged batch
+    Repeater {
+        model: 12
+        Rectangle {
+            objectName: "rect" + index
+            x: (index % 4) * 50; y: Math.floor(index / 4) * 50
+            width: 40; height: 40
+            color: index % 2 ? "blue" : "red"
+        }
+    }
+}
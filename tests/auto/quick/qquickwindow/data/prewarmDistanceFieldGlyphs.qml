@@ -0,0 +1,7 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    Text { text: "Prewarmed glyphs"; font.pixelSize: 20 }
+}
@@ -0,0 +1,8 @@
+import QtQuick 2.11
+import QtQuick.Window 2.11
+
+Window {
+    width: 200; height: 200
+    Rectangle { width: 100; height: 100; color: "red" }
+    Rectangle { x: 100; width: 100; height: 100; color: "blue"; opacity: 0.5 }
+}
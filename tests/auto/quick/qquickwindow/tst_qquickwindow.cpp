@@ -43,10 +43,14 @@
 #include "../shared/viewtestutil.h"
 #include <QSignalSpy>
 #include <private/qquickwindow_p.h>
+#include <private/qsgdistancefieldglyphstore_p.h>
 #include <private/qguiapplication_p.h>
+#include <QMutex>
 #include <QRunnable>
 #include <QOpenGLFunctions>
 #include <QSGRendererInterface>
+#include <QTemporaryDir>
+#include <QTextLayout>
 
 Q_LOGGING_CATEGORY(lcTests, "qt.quick.tests")
 
@@ -361,6 +365,55 @@ private:
     bool m_acceptTouch;
 };
 
+// Records the renderer statistics of every frame of a window. They are read
+// on the render thread as each frame is swapped, before the next frame can
+// replace them.
+class FrameStatisticsRecorder
+{
+public:
+    FrameStatisticsRecorder(QQuickWindow *window)
+        : m_frames(new Frames)
+    {
+        QSharedPointer<Frames> frames = m_frames;
+        QObject::connect(window, &QQuickWindow::frameSwapped, window, [window, frames]() {
+            const QVariantMap statistics = QQuickWindowPrivate::get(window)->rendererStatistics();
+            QMutexLocker locker(&frames->mutex);
+            frames->statistics.append(statistics);
+        }, Qt::DirectConnection);
+    }
+
+    int count() const
+    {
+        QMutexLocker locker(&m_frames->mutex);
+        return m_frames->statistics.count();
+    }
+
+    QVariantMap frame(int index) const
+    {
+        QMutexLocker locker(&m_frames->mutex);
+        return m_frames->statistics.value(index);
+    }
+
+    // The first frame from index on for which key is non-zero
+    QVariantMap firstFrameWith(int index, const char *key) const
+    {
+        QMutexLocker locker(&m_frames->mutex);
+        for (int i = index; i < m_frames->statistics.count(); ++i) {
+            if (m_frames->statistics.at(i).value(QLatin1String(key)).toLongLong() != 0)
+                return m_frames->statistics.at(i);
+        }
+        return QVariantMap();
+    }
+
+private:
+    struct Frames
+    {
+        QMutex mutex;
+        QVector<QVariantMap> statistics;
+    };
+    QSharedPointer<Frames> m_frames;
+};
+
 class tst_qquickwindow : public QQmlDataTest
 {
     Q_OBJECT
@@ -475,7 +528,19 @@ private slots:
     void testChildMouseEventFilter_data();
     void cleanupGrabsOnRelease();
 
+    void rendererStatistics();
+    void partialVertexUpload();
+    void parallelVertexCopy();
+    void cullOffscreenBatches();
+    void cullDisplacedVertices();
+    void partialUpdates();
+    void partialUpdatesDisplacedVertices();
+    void prewarmDistanceFieldGlyphs();
+
 private:
+    QQuickWindow *createWindow(QQmlEngine *engine, const QString &fileName);
+    static bool showAndWaitForFrame(QQuickWindow *window);
+
     QTouchDevice *touchDevice;
     QTouchDevice *touchDeviceWithVelocity;
 };
@@ -3556,6 +3621,325 @@ void tst_qquickwindow::cleanupGrabsOnRelease()
     QCOMPARE(parent->mouseUngrabEventCount, 1);
 }
 
+QQuickWindow *tst_qquickwindow::createWindow(QQmlEngine *engine, const QString &fileName)
+{
+    QQmlComponent component(engine, testFileUrl(fileName));
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(component.create());
+    if (!window) {
+        qWarning() << component.errors();
+        return nullptr;
+    }
+    window->setTitle(QTest::currentTestFunction());
+    return window;
+}
+
+bool tst_qquickwindow::showAndWaitForFrame(QQuickWindow *window)
+{
+    QSignalSpy swapSpy(window, SIGNAL(frameSwapped()));
+    window->show();
+    if (!QTest::qWaitForWindowExposed(window))
+        return false;
+    return !swapSpy.isEmpty() || swapSpy.wait();
+}
+
+void tst_qquickwindow::rendererStatistics()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "rendererStatistics.qml"));
+    QVERIFY(window);
+    FrameStatisticsRecorder recorder(window.data());
+
+    QVERIFY(showAndWaitForFrame(window.data()));
+
+    const QVariantMap statistics = QQuickWindowPrivate::get(window.data())->rendererStatistics();
+    QVERIFY(statistics.value("renderTime").toLongLong() > 0);
+    QVERIFY(statistics.value("preprocessTime").toLongLong() >= 0);
+    QVERIFY(statistics.value("updateTime").toLongLong() >= 0);
+    QVERIFY(statistics.value("bindingTime").toLongLong() >= 0);
+    QVERIFY(statistics.contains("rebuild"));
+
+    if (window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL) {
+        const int opaque = statistics.value("opaqueBatches").toInt();
+        const int alpha = statistics.value("alphaBatches").toInt();
+        QVERIFY(opaque > 0);
+        QVERIFY(alpha > 0);
+        QCOMPARE(statistics.value("mergedBatches").toInt() + statistics.value("unmergedBatches").toInt(),
+                 opaque + alpha);
+        QVERIFY(statistics.value("shaderChanges").toInt() > 0);
+    }
+
+    // Frame pacing is reported by the threaded render loop
+    QVERIFY(statistics.contains("frameInterval"));
+    QVERIFY(statistics.contains("swapTime"));
+    QOpenGLContext *context = window->openglContext();
+    if (context && context->thread() != QThread::currentThread()) {
+        const int frames = recorder.count();
+        window->update();
+        QTRY_VERIFY(recorder.count() > frames);
+        const QVariantMap pacing = recorder.frame(frames);
+        QVERIFY(pacing.value("frameInterval").toLongLong() > 0);
+        QVERIFY(pacing.value("syncTime").toLongLong() >= 0);
+        QVERIFY(pacing.value("renderThreadWindows").toInt() >= 1);
+    }
+}
+
+void tst_qquickwindow::partialVertexUpload()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "partialVertexUpload.qml"));
+    QVERIFY(window);
+    FrameStatisticsRecorder recorder(window.data());
+
+    QVERIFY(showAndWaitForFrame(window.data()));
+    if (window->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL)
+        QSKIP("Vertex uploads are only reported by the OpenGL renderer");
+
+    // The first frame uploads everything
+    QTRY_VERIFY(recorder.count() > 0);
+    const qint64 fullUpload = recorder.frame(0).value("vertexBytesUploaded").toLongLong();
+    QVERIFY(fullUpload > 0);
+
+    // Moving one rectangle only uploads its own vertices. Frames that were
+    // already being rendered when it moved upload nothing.
+    QQuickItem *moved = window->contentItem()->findChild<QQuickItem *>("rect0");
+    QVERIFY(moved);
+    const int frames = recorder.count();
+    moved->setY(155);
+    QTRY_VERIFY(!recorder.firstFrameWith(frames, "vertexBytesUploaded").isEmpty());
+    const qint64 partialUpload = recorder.firstFrameWith(frames, "vertexBytesUploaded").value("vertexBytesUploaded").toLongLong();
+    QVERIFY(partialUpload < fullUpload);
+
+    QImage content = window->grabWindow();
+    const qreal dpr = content.devicePixelRatio();
+    QCOMPARE(QColor(content.pixel(20 * dpr, 20 * dpr)), QColor(Qt::white));
+    QCOMPARE(QColor(content.pixel(20 * dpr, 175 * dpr)), QColor(Qt::red));
+    QCOMPARE(QColor(content.pixel(70 * dpr, 20 * dpr)), QColor(Qt::blue));
+    QCOMPARE(QColor(content.pixel(120 * dpr, 120 * dpr)), QColor(Qt::red));
+}
+
+void tst_qquickwindow::parallelVertexCopy()
+{
+    // The renderer picks up the thread count when it is created
+    const QByteArray threadCounts[] = { "1", "4" };
+    QImage images[2];
+    for (int i = 0; i < 2; ++i) {
+        qputenv("QSG_RENDERER_UPLOAD_THREADS", threadCounts[i]);
+        QQmlEngine engine;
+        QScopedPointer<QQuickWindow> window(createWindow(&engine, "parallelVertexCopy.qml"));
+        QVERIFY(window);
+        QVERIFY(showAndWaitForFrame(window.data()));
+        if (window->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL) {
+            qunsetenv("QSG_RENDERER_UPLOAD_THREADS");
+            QSKIP("Vertices are only copied in parallel by the OpenGL renderer");
+        }
+        images[i] = window->grabWindow();
+        QVERIFY(!images[i].isNull());
+    }
+    qunsetenv("QSG_RENDERER_UPLOAD_THREADS");
+
+    QCOMPARE(images[1], images[0]);
+}
+
+void tst_qquickwindow::cullOffscreenBatches()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "cullOffscreenBatches.qml"));
+    QVERIFY(window);
+    QVERIFY(showAndWaitForFrame(window.data()));
+    if (window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL)
+        QVERIFY(QQuickWindowPrivate::get(window.data())->rendererStatistics().value("culledBatches").toInt() > 0);
+
+    // Content that was culled must show up once it is moved into view
+    QQuickItem *offscreen = window->contentItem()->findChild<QQuickItem *>("offscreen");
+    QVERIFY(offscreen);
+    offscreen->setX(100);
+
+    QImage content = window->grabWindow();
+    const qreal dpr = content.devicePixelRatio();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::red));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::blue));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 150 * dpr)), QColor(Qt::white));
+}
+
+void tst_qquickwindow::cullDisplacedVertices()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "cullDisplacedVertices.qml"));
+    QVERIFY(window);
+    QVERIFY(showAndWaitForFrame(window.data()));
+    if (window->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL)
+        QSKIP("ShaderEffect vertex shaders need OpenGL");
+
+    QCOMPARE(QQuickWindowPrivate::get(window.data())->rendererStatistics().value("culledBatches").toInt(), 0);
+    QImage content = window->grabWindow();
+    const qreal dpr = content.devicePixelRatio();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::blue));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 150 * dpr)), QColor(Qt::white));
+}
+
+void tst_qquickwindow::partialUpdates()
+{
+    qputenv("QSG_PARTIAL_UPDATE", "1");
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "partialUpdates.qml"));
+    qunsetenv("QSG_PARTIAL_UPDATE");
+    QVERIFY(window);
+    QVERIFY(showAndWaitForFrame(window.data()));
+
+    QImage content = window->grabWindow();
+    qreal dpr = content.devicePixelRatio();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::red));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::blue));
+
+    // A change in one rectangle must keep the other one intact
+    QQuickItem *left = window->contentItem()->findChild<QQuickItem *>("left");
+    QVERIFY(left);
+    left->setProperty("color", QColor(Qt::green));
+    content = window->grabWindow();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::green));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::blue));
+
+    // Moving a rectangle must repaint the area it moved away from as well
+    QQuickItem *right = window->contentItem()->findChild<QQuickItem *>("right");
+    QVERIFY(right);
+    right->setY(100);
+    content = window->grabWindow();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::green));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::white));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 150 * dpr)), QColor(Qt::blue));
+
+    // And removing it must repaint the area it covered
+    delete right;
+    content = window->grabWindow();
+    QCOMPARE(QColor(content.pixel(150 * dpr, 150 * dpr)), QColor(Qt::white));
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::green));
+}
+
+void tst_qquickwindow::partialUpdatesDisplacedVertices()
+{
+    qputenv("QSG_PARTIAL_UPDATE", "1");
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "partialUpdatesDisplacedVertices.qml"));
+    qunsetenv("QSG_PARTIAL_UPDATE");
+    QVERIFY(window);
+    QVERIFY(showAndWaitForFrame(window.data()));
+    if (window->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL)
+        QSKIP("ShaderEffect vertex shaders need OpenGL");
+
+    QImage content = window->grabWindow();
+    const qreal dpr = content.devicePixelRatio();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::white));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::blue));
+
+    // The item's bounds stay the same, yet both the area the shader moved the
+    // geometry away from and the one it moved it to must be repainted
+    QQuickItem *effect = window->contentItem()->findChild<QQuickItem *>("effect");
+    QVERIFY(effect);
+    effect->setProperty("offset", 0);
+    content = window->grabWindow();
+    QCOMPARE(QColor(content.pixel(50 * dpr, 50 * dpr)), QColor(Qt::blue));
+    QCOMPARE(QColor(content.pixel(150 * dpr, 50 * dpr)), QColor(Qt::white));
+}
+
+void tst_qquickwindow::prewarmDistanceFieldGlyphs()
+{
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    QSGDistanceFieldGlyphStore *store = QSGDistanceFieldGlyphStore::instance();
+    store->setCacheDirectory(cacheDir.path());
+    const QSGDistanceFieldGlyphStore::Statistics before = store->statistics();
+
+    QFont font;
+    font.setPixelSize(20);
+    QQuickWindowPrivate::prewarmDistanceFieldGlyphs(font, QStringLiteral("Prewarmed glyphs"));
+    store->waitForDone();
+
+    const QSGDistanceFieldGlyphStore::Statistics prewarmed = store->statistics();
+    QVERIFY(prewarmed.prewarmedGlyphs > before.prewarmedGlyphs);
+    QVERIFY(prewarmed.savedGlyphs > before.savedGlyphs);
+    QVERIFY(prewarmed.prewarmTime >= before.prewarmTime);
+    QVERIFY(!QDir(cacheDir.path()).entryList(QStringList() << QStringLiteral("*.qsgdf")).isEmpty());
+
+    // The glyphs are loaded back from disk by another store, and match the
+    // distance fields generated for them
+    {
+        QSGDistanceFieldGlyphStore loadingStore;
+        loadingStore.setCacheDirectory(cacheDir.path());
+        loadingStore.waitForDone();
+        QVERIFY(loadingStore.statistics().loadedGlyphs > 0);
+        loadingStore.setCacheDirectory(QString());
+
+        QTextLayout layout(QStringLiteral("Prewarmed glyphs"), font);
+        layout.beginLayout();
+        while (layout.createLine().isValid()) { }
+        layout.endLayout();
+
+        int compared = 0;
+        const QList<QGlyphRun> glyphRuns = layout.glyphRuns();
+        for (const QGlyphRun &glyphRun : glyphRuns) {
+            const QByteArray key = QSGDistanceFieldGlyphStore::fontKey(glyphRun.rawFont());
+            const bool doubleResolution = QSGDistanceFieldGlyphStore::doubleGlyphResolution(glyphRun.rawFont());
+            QRawFont referenceFont = glyphRun.rawFont();
+            referenceFont.setPixelSize(QT_DISTANCEFIELD_BASEFONTSIZE(doubleResolution)
+                                       * QT_DISTANCEFIELD_SCALE(doubleResolution));
+            const QVector<quint32> glyphs = glyphRun.glyphIndexes();
+            for (quint32 glyph : glyphs) {
+                const QPainterPath path = referenceFont.pathForGlyph(glyph);
+                if (path.boundingRect().isEmpty())
+                    continue;
+                const QDistanceField generated(path, glyph, doubleResolution);
+                const QDistanceField loaded = loadingStore.find(key, glyph);
+                QVERIFY(!loaded.isNull());
+                QCOMPARE(loaded.glyph(), generated.glyph());
+                QCOMPARE(loaded.width(), generated.width());
+                QCOMPARE(loaded.height(), generated.height());
+                QVERIFY(memcmp(loaded.constBits(), generated.constBits(),
+                               generated.width() * generated.height()) == 0);
+                ++compared;
+            }
+        }
+        QVERIFY(compared > 0);
+    }
+
+    // A damaged file claiming huge distance fields is ignored
+    {
+        QTemporaryDir damagedDir;
+        QVERIFY(damagedDir.isValid());
+        QByteArray glyphData;
+        {
+            QDataStream glyphStream(&glyphData, QIODevice::WriteOnly);
+            glyphStream.setVersion(QDataStream::Qt_5_11);
+            glyphStream << quint32(1) << quint32(42) << quint16(65535) << quint16(65535);
+        }
+        QFile file(damagedDir.path() + QLatin1String("/damaged.qsgdf"));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QDataStream stream(&file);
+        stream.setVersion(QDataStream::Qt_5_11);
+        stream << quint32(0x51534744) << quint32(1) << QByteArray("damaged") << qCompress(glyphData);
+        file.close();
+
+        QSGDistanceFieldGlyphStore loadingStore;
+        loadingStore.setCacheDirectory(damagedDir.path());
+        loadingStore.waitForDone();
+        QCOMPARE(loadingStore.statistics().loadedGlyphs, 0);
+        QVERIFY(loadingStore.find(QByteArray("damaged"), 42).isNull());
+        loadingStore.setCacheDirectory(QString());
+    }
+
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window(createWindow(&engine, "prewarmDistanceFieldGlyphs.qml"));
+    QVERIFY(window);
+    QVERIFY(showAndWaitForFrame(window.data()));
+
+    // The distance field text uses the prewarmed glyphs instead of generating them
+    if (window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL)
+        QVERIFY(store->statistics().storeHits > prewarmed.storeHits);
+
+    store->waitForDone();
+    store->setCacheDirectory(QString());
+}
+
 QTEST_MAIN(tst_qquickwindow)
 
 #include "tst_qquickwindow.moc"
@@ -7,7 +7,8 @@ PUBLICTESTS += \
 qtConfig(opengl(es1|es2)?) {
     PUBLICTESTS += \
         drawingmodes \
-        rendernode
+        rendernode \
+        sharedrenderthread
     qtHaveModule(widgets): PUBLICTESTS += nodes
 
     QUICKTESTS += \
@@ -77,6 +78,7 @@ QUICKTESTS += \
     qquickrectangle \
     qquickrepeater \
     qquickshortcut \
+    qquicktableview \
     qquicktext \
     qquicktextdocument \
     qquicktextedit \
@@ -88,7 +90,8 @@ QUICKTESTS += \
     qquickscreen \
     touchmouse \
     scenegraph \
-    sharedimage
+    sharedimage \
+    softwarerenderer
 
 SUBDIRS += $$PUBLICTESTS
 
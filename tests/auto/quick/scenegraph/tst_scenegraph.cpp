@@ -43,6 +43,7 @@
 
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
+#include <private/qsgbatchrenderer_p.h>
 
 #include "../../shared/util.h"
 #include "../shared/visualtestutil.h"
@@ -114,6 +115,9 @@ private slots:
     void createTextureFromImage_data();
     void createTextureFromImage();
 
+    void transformPositions_data();
+    void transformPositions();
+
 private:
     bool m_brokenMipmapSupport;
     QQuickView *createView(const QString &file, QWindow *parent = nullptr, int x = -1, int y = -1, int w = -1, int h = -1);
@@ -555,6 +559,68 @@ void tst_SceneGraph::createTextureFromImage()
     QCOMPARE(texture->hasAlphaChannel(), expectedAlpha);
 }
 
+void tst_SceneGraph::transformPositions_data()
+{
+    QTest::addColumn<int>("vertexSize");
+    QTest::addColumn<int>("vertexCount");
+    QTest::addColumn<QMatrix4x4>("matrix");
+
+    QMatrix4x4 translate;
+    translate.translate(10.5, -3.25);
+    QMatrix4x4 scale;
+    scale.scale(2, 0.5);
+    QMatrix4x4 rotate;
+    rotate.translate(100, 50);
+    rotate.rotate(30, 0, 0, 1);
+    rotate.scale(1.5);
+
+    QTest::newRow("identity") << int(sizeof(float) * 2) << 7 << QMatrix4x4();
+    QTest::newRow("translate, Point2D") << int(sizeof(float) * 2) << 33 << translate;
+    QTest::newRow("translate, ColoredPoint2D") << int(sizeof(float) * 3) << 64 << translate;
+    QTest::newRow("scale, single vertex") << int(sizeof(float) * 2) << 1 << scale;
+    QTest::newRow("rotate, TexturedPoint2D") << int(sizeof(float) * 4) << 31 << rotate;
+    QTest::newRow("rotate, ColoredPoint2D") << int(sizeof(float) * 3) << 1000 << rotate;
+}
+
+void tst_SceneGraph::transformPositions()
+{
+    QFETCH(int, vertexSize);
+    QFETCH(int, vertexCount);
+    QFETCH(QMatrix4x4, matrix);
+    // Let the matrix work out its type, like the combined matrices of nodes do
+    matrix.optimize();
+
+    QByteArray original(vertexSize * vertexCount, Qt::Uninitialized);
+    for (int i = 0; i < vertexCount; ++i) {
+        char *vertex = original.data() + i * vertexSize;
+        float *position = reinterpret_cast<float *>(vertex);
+        position[0] = i * 1.37f - 20.0f;
+        position[1] = 300.0f - i * 0.71f;
+        for (int j = 2 * sizeof(float); j < vertexSize; ++j)
+            vertex[j] = char(i + j);
+    }
+
+    QByteArray scalar = original;
+    QByteArray vectorized = original;
+    QSGBatchRenderer::qsg_transformPositionsScalar(scalar.data(), vertexCount, vertexSize, matrix);
+    QSGBatchRenderer::qsg_transformPositions(vectorized.data(), vertexCount, vertexSize, matrix);
+
+    // The SSE2 and NEON paths must give exactly the same bits as the scalar one
+    QCOMPARE(vectorized, scalar);
+
+    for (int i = 0; i < vertexCount; ++i) {
+        const int offset = i * vertexSize;
+        const float *position = reinterpret_cast<const float *>(original.constData() + offset);
+        const QPointF expected = matrix.map(QPointF(position[0], position[1]));
+        const float *transformed = reinterpret_cast<const float *>(scalar.constData() + offset);
+        QVERIFY(qAbs(transformed[0] - expected.x()) < 0.01);
+        QVERIFY(qAbs(transformed[1] - expected.y()) < 0.01);
+        // Only the position is touched
+        QCOMPARE(scalar.mid(offset + 2 * sizeof(float), vertexSize - 2 * sizeof(float)),
+                 original.mid(offset + 2 * sizeof(float), vertexSize - 2 * sizeof(float)));
+    }
+}
+
 bool tst_SceneGraph::isRunningOnOpenGL()
 {
     bool retval = false;
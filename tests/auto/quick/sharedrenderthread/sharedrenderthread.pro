@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_sharedrenderthread
+SOURCES += tst_sharedrenderthread.cpp
+
+macos:CONFIG -= app_bundle
+
+QT += gui qml quick quick-private testlib
@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtGui/QOpenGLContext>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/private/qquickwindow_p.h>
+
+// The render loop is created with the first window and reads the environment
+// only then, so these tests run in their own process.
+class tst_sharedrenderthread : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void twoWindows();
+};
+
+void tst_sharedrenderthread::initTestCase()
+{
+    qputenv("QSG_RENDER_LOOP", "threaded");
+    qputenv("QSG_RENDER_THREADS", "1");
+}
+
+static QQuickWindow *createWindow(QQmlEngine *engine, const QColor &color)
+{
+    QQmlComponent component(engine);
+    component.setData("import QtQuick 2.11\n"
+                      "import QtQuick.Window 2.11\n"
+                      "Window {\n"
+                      "    width: 100; height: 100\n"
+                      "    Rectangle { objectName: \"rect\"; anchors.fill: parent }\n"
+                      "}", QUrl());
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(component.create());
+    if (window)
+        window->contentItem()->findChild<QQuickItem *>("rect")->setProperty("color", color);
+    return window;
+}
+
+static QColor centerColor(QQuickWindow *window)
+{
+    const QImage content = window->grabWindow();
+    const qreal dpr = content.devicePixelRatio();
+    return QColor(content.pixel(50 * dpr, 50 * dpr));
+}
+
+void tst_sharedrenderthread::twoWindows()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> first(createWindow(&engine, Qt::red));
+    QScopedPointer<QQuickWindow> second(createWindow(&engine, Qt::blue));
+    QVERIFY(first);
+    QVERIFY(second);
+    first->setTitle(QStringLiteral("first"));
+    second->setTitle(QStringLiteral("second"));
+    second->setPosition(first->x() + 150, first->y());
+
+    QSignalSpy firstSwapSpy(first.data(), SIGNAL(frameSwapped()));
+    QSignalSpy secondSwapSpy(second.data(), SIGNAL(frameSwapped()));
+    first->show();
+    second->show();
+    QVERIFY(QTest::qWaitForWindowExposed(first.data()));
+    QVERIFY(QTest::qWaitForWindowExposed(second.data()));
+    QTRY_VERIFY(firstSwapSpy.count() > 0);
+    QTRY_VERIFY(secondSwapSpy.count() > 0);
+
+    QOpenGLContext *context = first->openglContext();
+    if (!context || context->thread() == QThread::currentThread())
+        QSKIP("Sharing render threads needs the threaded render loop");
+
+    // Both windows are rendered by the same thread and OpenGL context
+    QCOMPARE(second->openglContext(), context);
+
+    // The first window's first frame may predate the second window
+    int swaps = firstSwapSpy.count();
+    first->update();
+    QTRY_VERIFY(firstSwapSpy.count() > swaps);
+    QCOMPARE(QQuickWindowPrivate::get(first.data())->rendererStatistics().value("renderThreadWindows").toInt(), 2);
+    QCOMPARE(QQuickWindowPrivate::get(second.data())->rendererStatistics().value("renderThreadWindows").toInt(), 2);
+    QCOMPARE(centerColor(first.data()), QColor(Qt::red));
+    QCOMPARE(centerColor(second.data()), QColor(Qt::blue));
+
+    // Both keep rendering when only one of them changes
+    swaps = secondSwapSpy.count();
+    second->contentItem()->findChild<QQuickItem *>("rect")->setProperty("color", QColor(Qt::green));
+    QTRY_VERIFY(secondSwapSpy.count() > swaps);
+    QCOMPARE(centerColor(first.data()), QColor(Qt::red));
+    QCOMPARE(centerColor(second.data()), QColor(Qt::green));
+
+    // Destroying one window leaves the thread rendering the other
+    first.reset();
+    swaps = secondSwapSpy.count();
+    second->contentItem()->findChild<QQuickItem *>("rect")->setProperty("color", QColor(Qt::yellow));
+    QTRY_VERIFY(secondSwapSpy.count() > swaps);
+    QCOMPARE(QQuickWindowPrivate::get(second.data())->rendererStatistics().value("renderThreadWindows").toInt(), 1);
+    QCOMPARE(centerColor(second.data()), QColor(Qt::yellow));
+}
+
+QTEST_MAIN(tst_sharedrenderthread)
+
+#include "tst_sharedrenderthread.moc"
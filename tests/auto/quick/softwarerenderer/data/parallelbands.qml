@@ -0,0 +1,59 @@
+import QtQuick 2.0
+
+Rectangle {
+    width: 400
+    height: 400
+    color: "white"
+
+    Repeater {
+        model: 12
+        Rectangle {
+            x: (index % 4) * 95 + 10
+            y: Math.floor(index / 4) * 125 + 20
+            width: 110
+            height: 140
+            radius: 8 + index * 2
+            border.width: index % 3
+            border.color: "black"
+            rotation: index * 7
+            opacity: index % 2 ? 0.6 : 1
+            gradient: Gradient {
+                GradientStop { position: 0; color: "steelblue" }
+                GradientStop { position: 1; color: Qt.rgba(index / 12, 0.5, 0.2, 1) }
+            }
+        }
+    }
+
+    Image {
+        x: 20
+        y: 50
+        width: 170
+        height: 300
+        source: "checkers.png"
+        smooth: true
+        mirror: true
+    }
+
+    Item {
+        x: 200
+        y: 40
+        width: 180
+        height: 320
+        clip: true
+        Rectangle {
+            anchors.centerIn: parent
+            width: 300
+            height: 80
+            radius: 20
+            rotation: 45
+            color: "orange"
+        }
+    }
+
+    Text {
+        width: parent.width
+        wrapMode: Text.WordWrap
+        font.pixelSize: 24
+        text: new Array(9).join("The quick brown fox jumps over the lazy dog. ")
+    }
+}
@@ -0,0 +1,32 @@
+import QtQuick 2.0
+
+Rectangle {
+    id: root
+    width: 200
+    height: 200
+    color: "white"
+
+    property Item added: null
+
+    function addItem() {
+        added = blueComponent.createObject(root)
+    }
+
+    Rectangle {
+        objectName: "red"
+        width: 100
+        height: 100
+        color: "#ff0000"
+    }
+
+    Component {
+        id: blueComponent
+        Rectangle {
+            x: 50
+            y: 50
+            width: 100
+            height: 100
+            color: "#0000ff"
+        }
+    }
+}
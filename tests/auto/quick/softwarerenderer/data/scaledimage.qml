@@ -0,0 +1,17 @@
+import QtQuick 2.0
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    Image {
+        objectName: "image"
+        x: 10
+        y: 10
+        width: 96
+        height: 96
+        source: "checkers.png"
+        smooth: true
+    }
+}
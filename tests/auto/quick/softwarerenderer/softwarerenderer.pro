@@ -0,0 +1,17 @@
+CONFIG += testcase
+TARGET = tst_softwarerenderer
+SOURCES += tst_softwarerenderer.cpp
+
+macos:CONFIG -= app_bundle
+
+TESTDATA = data/*
+
+include(../../shared/util.pri)
+include(../shared/util.pri)
+
+QT += core-private gui-private qml-private quick-private testlib
+
+OTHER_FILES += \
+    data/parallelbands.qml \
+    data/renderlist.qml \
+    data/scaledimage.qml
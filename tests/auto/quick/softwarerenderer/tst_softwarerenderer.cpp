@@ -0,0 +1,216 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/qpainter.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuick/private/qsgsoftwarerenderer_p.h>
+#include "../../shared/util.h"
+#include "../shared/visualtestutil.h"
+
+using namespace QQuickVisualTestUtil;
+
+class tst_softwarerenderer : public QQmlDataTest
+{
+    Q_OBJECT
+public:
+    tst_softwarerenderer();
+
+private slots:
+    void parallelBands();
+    void renderListUpdates();
+    void scaledImage();
+};
+
+tst_softwarerenderer::tst_softwarerenderer()
+{
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+// Returns what the renderer has painted into the window's backing store. Unlike
+// grabWindow(), this also works on the offscreen and minimal platforms.
+static QImage renderedContent(QQuickWindow *window)
+{
+    QSGSoftwareRenderer *renderer = static_cast<QSGSoftwareRenderer *>(QQuickWindowPrivate::get(window)->renderer);
+    if (!renderer)
+        return QImage();
+    QPaintDevice *device = renderer->currentPaintDevice();
+    if (!device || device->devType() != QInternal::Image)
+        return QImage();
+    return static_cast<QImage *>(device)->convertToFormat(QImage::Format_ARGB32_Premultiplied);
+}
+
+static QColor renderedPixel(QQuickWindow *window, const QPoint &pos)
+{
+    const QImage content = renderedContent(window);
+    if (content.isNull())
+        return QColor();
+    return content.pixelColor(pos * content.devicePixelRatioF());
+}
+
+// Each band is painted with its own translation, which may move the result of
+// gradients and smooth scaling by a rounding step.
+static bool fuzzyCompareImages(const QImage &a, const QImage &b)
+{
+    if (a.size() != b.size())
+        return false;
+    const int tolerance = 1;
+    for (int y = 0; y < a.height(); ++y) {
+        const QRgb *as = reinterpret_cast<const QRgb *>(a.constScanLine(y));
+        const QRgb *bs = reinterpret_cast<const QRgb *>(b.constScanLine(y));
+        for (int x = 0; x < a.width(); ++x) {
+            if (qAbs(qRed(as[x]) - qRed(bs[x])) > tolerance
+                    || qAbs(qGreen(as[x]) - qGreen(bs[x])) > tolerance
+                    || qAbs(qBlue(as[x]) - qBlue(bs[x])) > tolerance
+                    || qAbs(qAlpha(as[x]) - qAlpha(bs[x])) > tolerance) {
+                qWarning() << "images differ at" << x << y << hex << as[x] << bs[x];
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// What a smoothly scaled image painted directly onto a white background looks like
+static QImage paintScaledImage(const QImage &source, const QSize &size)
+{
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+    QPainter painter(&image);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+    painter.drawImage(QRect(QPoint(0, 0), size), source);
+    return image;
+}
+
+void tst_softwarerenderer::parallelBands()
+{
+    // The renderer picks up the thread count when it is created, which
+    // happens when the window renders its first frame.
+    const QByteArray threadCounts[] = { "1", "4" };
+    QImage images[2];
+    for (int i = 0; i < 2; ++i) {
+        qputenv("QSG_SOFTWARE_RENDER_THREADS", threadCounts[i]);
+
+        QQuickView window;
+        window.setSource(testFileUrl("parallelbands.qml"));
+        window.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&window));
+        if (window.rendererInterface()->graphicsApi() != QSGRendererInterface::Software)
+            QSKIP("The software backend is not in use");
+        QTRY_VERIFY(QQuickWindowPrivate::get(&window)->renderer);
+
+        images[i] = renderedContent(&window);
+        QVERIFY(!images[i].isNull());
+    }
+    qunsetenv("QSG_SOFTWARE_RENDER_THREADS");
+
+    // The whole window is painted in the first frame, which is large enough
+    // to be split into bands.
+    QCOMPARE(images[0].size(), QSize(400, 400) * images[0].devicePixelRatioF());
+    QVERIFY(fuzzyCompareImages(images[0], images[1]));
+}
+
+void tst_softwarerenderer::renderListUpdates()
+{
+    QQuickView window;
+    window.setSource(testFileUrl("renderlist.qml"));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    if (window.rendererInterface()->graphicsApi() != QSGRendererInterface::Software)
+        QSKIP("The software backend is not in use");
+
+    const QColor white(Qt::white);
+    const QColor red(Qt::red);
+    const QColor blue(Qt::blue);
+    QTRY_COMPARE(renderedPixel(&window, QPoint(75, 75)), red);
+
+    // Adding an item adds its node to the render list
+    QQuickItem *root = window.rootObject();
+    QVERIFY(QMetaObject::invokeMethod(root, "addItem"));
+    QQuickItem *blueItem = qvariant_cast<QQuickItem *>(root->property("added"));
+    QVERIFY(blueItem);
+    QTRY_COMPARE(renderedPixel(&window, QPoint(75, 75)), blue);
+    QCOMPARE(renderedPixel(&window, QPoint(25, 25)), red);
+
+    // Restacking reorders it
+    QQuickItem *redItem = findItem<QQuickItem>(root, "red");
+    QVERIFY(redItem);
+    redItem->setZ(1);
+    QTRY_COMPARE(renderedPixel(&window, QPoint(75, 75)), red);
+
+    // Removing an item removes its node
+    delete redItem;
+    QTRY_COMPARE(renderedPixel(&window, QPoint(25, 25)), white);
+    QCOMPARE(renderedPixel(&window, QPoint(75, 75)), blue);
+
+    // Moving an item keeps the render list
+    blueItem->setX(100);
+    QTRY_COMPARE(renderedPixel(&window, QPoint(125, 75)), blue);
+    QCOMPARE(renderedPixel(&window, QPoint(75, 75)), white);
+}
+
+void tst_softwarerenderer::scaledImage()
+{
+    QQuickView window;
+    window.setSource(testFileUrl("scaledimage.qml"));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    if (window.rendererInterface()->graphicsApi() != QSGRendererInterface::Software)
+        QSKIP("The software backend is not in use");
+    if (!qFuzzyCompare(window.effectiveDevicePixelRatio(), qreal(1)))
+        QSKIP("The expected images assume a device pixel ratio of 1");
+
+    QQuickItem *image = findItem<QQuickItem>(window.rootObject(), "image");
+    QVERIFY(image);
+    const QImage source = QImage(testFile("checkers.png")).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QVERIFY(!source.isNull());
+
+    // While the size changes from frame to frame, the image is painted directly
+    for (int width = 97; width <= 100; ++width) {
+        image->setWidth(width);
+        const QImage expected = paintScaledImage(source, QSize(width, 96));
+        QTRY_VERIFY(fuzzyCompareImages(renderedContent(&window).copy(QRect(QPoint(10, 10), expected.size())), expected));
+    }
+
+    // Once the size has been kept for a frame, the prescaled image is blitted
+    image->setX(20);
+    const QImage scaled = source.scaled(100, 96, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    QTRY_VERIFY(fuzzyCompareImages(renderedContent(&window).copy(QRect(QPoint(20, 10), scaled.size())), scaled));
+    image->setY(20);
+    QTRY_VERIFY(fuzzyCompareImages(renderedContent(&window).copy(QRect(QPoint(20, 20), scaled.size())), scaled));
+
+    // A new size does not use the stale prescaled image
+    image->setHeight(90);
+    const QImage expected = paintScaledImage(source, QSize(100, 90));
+    QTRY_VERIFY(fuzzyCompareImages(renderedContent(&window).copy(QRect(QPoint(20, 20), expected.size())), expected));
+}
+
+QTEST_MAIN(tst_softwarerenderer)
+
+#include "tst_softwarerenderer.moc"
@@ -6,6 +6,7 @@ SUBDIRS += \
            javascript \
            holistic \
            qqmlchangeset \
+           qqmllistcompositor \
            qqmlcomponent \
            qqmlmetaproperty \
            librarymetrics_performance \
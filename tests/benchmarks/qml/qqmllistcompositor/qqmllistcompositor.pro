@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TEMPLATE = app
+TARGET = tst_qqmllistcompositor
+QT += qml-private testlib
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_qqmllistcompositor.cpp
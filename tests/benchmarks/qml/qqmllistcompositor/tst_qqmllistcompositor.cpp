@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <qtest.h>
+
+#include <private/qqmllistcompositor_p.h>
+
+class tst_qqmllistcompositor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void find_data();
+    void find();
+    void setFlags();
+
+private:
+    enum {
+        Visible = QQmlListCompositor::MinimumGroupCount,
+        VisibleFlag = 1 << Visible
+    };
+
+    void populate(QQmlListCompositor *compositor, int rangeCount);
+
+    int list = 0;
+};
+
+// Builds a compositor that looks like a large DelegateModel with a filter group: ranges of items
+// alternate between being and not being in the visible group, so none of them can be merged.
+void tst_qqmllistcompositor::populate(QQmlListCompositor *compositor, int rangeCount)
+{
+    compositor->setGroupCount(Visible + 1);
+    for (int i = 0, index = 0; i < rangeCount; ++i) {
+        const int count = 1 + i % 4;
+        const uint flags = i % 2 == 0
+                ? QQmlListCompositor::DefaultFlag | VisibleFlag
+                : QQmlListCompositor::DefaultFlag;
+        compositor->append(&list, index, count, flags);
+        index += count;
+    }
+}
+
+void tst_qqmllistcompositor::find_data()
+{
+    QTest::addColumn<int>("rangeCount");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("10000") << 10000;
+    QTest::newRow("100000") << 100000;
+}
+
+void tst_qqmllistcompositor::find()
+{
+    QFETCH(int, rangeCount);
+
+    QQmlListCompositor compositor;
+    populate(&compositor, rangeCount);
+
+    const QQmlListCompositor::Group visible = QQmlListCompositor::Group(Visible);
+    const int count = compositor.count(visible);
+
+    // Jump back and forth across the whole model, as a view does when it is flicked
+    // quickly or repositioned.
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i)
+            compositor.find(visible, (i * 7919) % count);
+    }
+}
+
+void tst_qqmllistcompositor::setFlags()
+{
+    QQmlListCompositor compositor;
+    populate(&compositor, 10000);
+
+    const QQmlListCompositor::Group visible = QQmlListCompositor::Group(Visible);
+    const int count = compositor.count(QQmlListCompositor::Default);
+
+    // Each modification invalidates the lookup structures, so this measures the cost of a find
+    // that directly follows a change.
+    QBENCHMARK {
+        for (int i = 0; i < 100; ++i) {
+            const int index = (i * 7919) % count;
+            compositor.setFlags(QQmlListCompositor::Default, index, 1, VisibleFlag);
+            compositor.clearFlags(QQmlListCompositor::Default, index, 1, VisibleFlag);
+            compositor.find(visible, compositor.count(visible) / 2);
+        }
+    }
+}
+
+QTEST_MAIN(tst_qqmllistcompositor)
+#include "tst_qqmllistcompositor.moc"
@@ -0,0 +1,35 @@
+import QtQuick 2.11
+import QtQuick.Layouts 1.3
+
+// 50 rows of 20 items, each row a RowLayout inside a ColumnLayout inside a RowLayout
+RowLayout {
+    id: root
+    width: 1200
+    height: 800
+
+    property int itemWidth: 10
+    property int singleHeight: 10
+
+    ColumnLayout {
+        Layout.fillWidth: true
+        Layout.fillHeight: true
+
+        Repeater {
+            model: 50
+            RowLayout {
+                property int row: index
+                Layout.fillWidth: true
+
+                Repeater {
+                    model: 20
+                    Rectangle {
+                        objectName: "item" + parent.row + "_" + index
+                        implicitWidth: root.itemWidth
+                        implicitHeight: parent.row === 25 && index === 10 ? root.singleHeight : 10
+                        Layout.fillWidth: index % 2 === 0
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TEMPLATE = app
+TARGET = tst_qquicklayouts
+QT += quick quick-private qml testlib
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_qquicklayouts.cpp
+
+include (../../../auto/shared/util.pri)
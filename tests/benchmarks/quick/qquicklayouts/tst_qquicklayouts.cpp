@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquickwindow_p.h>
+#include "../../../auto/shared/util.h"
+
+class tst_qquicklayouts : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase() override;
+    void changeAllItems();
+    void changeSingleItem();
+
+private:
+    void polish() { QQuickWindowPrivate::get(&window)->polishItems(); }
+
+    QQuickView window;
+};
+
+void tst_qquicklayouts::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    window.setSource(testFileUrl("nestedlayouts.qml"));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(window.rootObject());
+}
+
+// Every item changes its size hint within one frame
+void tst_qquicklayouts::changeAllItems()
+{
+    QObject *root = window.rootObject();
+    int width = 10;
+
+    QBENCHMARK {
+        width = width == 10 ? 11 : 10;
+        root->setProperty("itemWidth", width);
+        polish();
+    }
+}
+
+// A single item deep in the tree changes its size hint
+void tst_qquicklayouts::changeSingleItem()
+{
+    QObject *root = window.rootObject();
+    int height = 10;
+
+    QBENCHMARK {
+        height = height == 10 ? 12 : 10;
+        root->setProperty("singleHeight", height);
+        polish();
+    }
+}
+
+QTEST_MAIN(tst_qquicklayouts)
+
+#include "tst_qquicklayouts.moc"
@@ -1,4 +1,7 @@
 TEMPLATE = subdirs
 
 SUBDIRS += \
-           events
+           events \
+           qquicklayouts \
+           softwareimages \
+           tableview
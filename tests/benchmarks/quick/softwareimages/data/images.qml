@@ -0,0 +1,65 @@
+import QtQuick 2.11
+
+Item {
+    id: root
+    width: 640
+    height: 480
+
+    // "plain", "scaled", "tiled" or "border"
+    property string mode: "plain"
+    // Shifts every image so that the whole scene is repainted each frame
+    property int phase: 0
+
+    Component {
+        id: plainImage
+        Image {
+            source: "tile.png"
+        }
+    }
+
+    Component {
+        id: scaledImage
+        Image {
+            width: 100
+            height: 100
+            smooth: true
+            source: "tile.png"
+        }
+    }
+
+    Component {
+        id: tiledImage
+        Image {
+            width: 100
+            height: 100
+            fillMode: Image.Tile
+            source: "tile.png"
+        }
+    }
+
+    Component {
+        id: borderImage
+        BorderImage {
+            width: 100
+            height: 100
+            border { left: 16; top: 16; right: 16; bottom: 16 }
+            source: "tile.png"
+        }
+    }
+
+    Grid {
+        x: root.phase
+        columns: 6
+        spacing: 4
+
+        Repeater {
+            model: 24
+            Loader {
+                sourceComponent: root.mode === "scaled" ? scaledImage
+                               : root.mode === "tiled" ? tiledImage
+                               : root.mode === "border" ? borderImage
+                               : plainImage
+            }
+        }
+    }
+}
@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TEMPLATE = app
+TARGET = tst_softwareimages
+QT += quick qml testlib
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_softwareimages.cpp
+
+include (../../../auto/shared/util.pri)
@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+#include <QtQuick/qquickview.h>
+#include <QtTest/QSignalSpy>
+#include "../../../auto/shared/util.h"
+
+class tst_softwareimages : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_softwareimages();
+
+private slots:
+    void initTestCase() override;
+    void cleanupTestCase();
+    void render_data();
+    void render();
+
+private:
+    QQuickView *window = nullptr;
+};
+
+tst_softwareimages::tst_softwareimages()
+{
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+void tst_softwareimages::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    window = new QQuickView;
+    window->setSource(testFileUrl("images.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+    QVERIFY(window->rootObject());
+}
+
+void tst_softwareimages::cleanupTestCase()
+{
+    delete window;
+}
+
+void tst_softwareimages::render_data()
+{
+    QTest::addColumn<QString>("mode");
+
+    QTest::newRow("plain") << QStringLiteral("plain");
+    QTest::newRow("scaled") << QStringLiteral("scaled");
+    QTest::newRow("tiled") << QStringLiteral("tiled");
+    QTest::newRow("border") << QStringLiteral("border");
+}
+
+// Repaints the whole scene every frame and reports the achieved frame rate
+void tst_softwareimages::render()
+{
+    QFETCH(QString, mode);
+
+    QObject *root = window->rootObject();
+    root->setProperty("mode", mode);
+
+    QSignalSpy frameSpy(window, &QQuickWindow::frameSwapped);
+    window->update();
+    QVERIFY(frameSpy.wait());
+
+    // Spin an event loop per frame, polling would cap the frame rate
+    QEventLoop frameLoop;
+    connect(window, &QQuickWindow::frameSwapped, &frameLoop, &QEventLoop::quit);
+    QTimer timeout;
+    timeout.setInterval(5000);
+    connect(&timeout, &QTimer::timeout, &frameLoop, &QEventLoop::quit);
+
+    const int frames = 200;
+    frameSpy.clear();
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < frames; ++i) {
+        root->setProperty("phase", (i % 2) + 1);
+        timeout.start();
+        frameLoop.exec();
+        QCOMPARE(frameSpy.count(), i + 1);
+    }
+
+    const qint64 elapsed = qMax<qint64>(timer.elapsed(), 1);
+    QTest::setBenchmarkResult(frames * 1000.0 / elapsed, QTest::FramesPerSecond);
+}
+
+QTEST_MAIN(tst_softwareimages)
+
+#include "tst_softwareimages.moc"
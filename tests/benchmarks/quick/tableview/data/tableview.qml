@@ -0,0 +1,18 @@
+import QtQuick 2.11
+
+TableView {
+    width: 800
+    height: 600
+    columnSpacing: 1
+    rowSpacing: 1
+
+    delegate: Rectangle {
+        implicitWidth: 80
+        implicitHeight: 24
+        color: TableView.row % 2 ? "white" : "lightgray"
+        Text {
+            anchors.centerIn: parent
+            text: display
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/private/qquicktableview_p.h>
+#include "../../../auto/shared/util.h"
+
+class LargeTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    LargeTableModel(int rows, int columns) : m_rows(rows), m_columns(columns) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_rows;
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_columns;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || role != Qt::DisplayRole)
+            return QVariant();
+        return index.row() * m_columns + index.column();
+    }
+
+private:
+    int m_rows;
+    int m_columns;
+};
+
+class tst_tableview : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_tableview() : model(10000, 200) {}
+
+private slots:
+    void initTestCase() override;
+    void flick_data();
+    void flick();
+    void jump_data();
+    void jump();
+
+private:
+    QQuickTableView *tableView() const { return qobject_cast<QQuickTableView *>(window.rootObject()); }
+
+    LargeTableModel model;
+    QQuickView window;
+};
+
+void tst_tableview::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    window.setSource(testFileUrl("tableview.qml"));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(tableView());
+    tableView()->setModel(QVariant::fromValue(&model));
+    QCOMPARE(tableView()->rows(), 10000);
+    QCOMPARE(tableView()->columns(), 200);
+}
+
+void tst_tableview::flick_data()
+{
+    QTest::addColumn<bool>("reuseItems");
+    QTest::newRow("reuse") << true;
+    QTest::newRow("no reuse") << false;
+}
+
+// Scroll diagonally in small steps, loading and unloading one row or column at a time
+void tst_tableview::flick()
+{
+    QFETCH(bool, reuseItems);
+    QQuickTableView *view = tableView();
+    view->setReuseItems(reuseItems);
+    view->setContentX(0);
+    view->setContentY(0);
+
+    QBENCHMARK {
+        for (int step = 1; step <= 200; ++step) {
+            view->setContentX(step * 9);
+            view->setContentY(step * 7);
+        }
+        view->setContentX(0);
+        view->setContentY(0);
+    }
+}
+
+void tst_tableview::jump_data()
+{
+    flick_data();
+}
+
+// Move the viewport by more than a page, which rebuilds the whole table
+void tst_tableview::jump()
+{
+    QFETCH(bool, reuseItems);
+    QQuickTableView *view = tableView();
+    view->setReuseItems(reuseItems);
+    view->setContentX(0);
+    view->setContentY(0);
+
+    QBENCHMARK {
+        for (int page = 1; page <= 20; ++page) {
+            view->setContentX(page * 700);
+            view->setContentY(page * 6000);
+        }
+        view->setContentX(0);
+        view->setContentY(0);
+    }
+}
+
+QTEST_MAIN(tst_tableview)
+
+#include "tst_tableview.moc"